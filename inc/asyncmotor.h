@@ -0,0 +1,99 @@
+#ifndef ASYNCMOTOR_H
+#define ASYNCMOTOR_H
+
+#include <QObject>
+#include <QString>
+#include <functional>
+#include <memory>
+#include <optional>
+#include "motorcontrol.h"
+#include "motortask.h"
+#include "serialhandler.h"
+
+class AsyncMotor;
+class QTimer;
+
+// co_await 가능한 응답 대기. 명령 전송 후 matcher 가 결과를 돌려줄 때까지 코루틴을 멈춘다.
+class MotorAwaiter
+{
+public:
+    using Matcher = std::function<std::optional<MotorResult>(const QString &line)>;
+    using StartHook = std::function<bool()>;
+    using FinishHook = std::function<void(MotorResult)>;
+
+    MotorAwaiter(AsyncMotor *motor, const QString &command, Matcher matcher, int timeoutMs);
+    explicit MotorAwaiter(MotorResult immediate);   // 기다릴 필요 없이 바로 완료
+
+    // onStart: co_await 시점, 명령 전송 직전에 호출. false 면 전송하지 않고 Failed 로 완료
+    // onFinish: 결과가 정해진 뒤 코루틴 재개 직전에 호출 (Timeout 포함)
+    void setHooks(StartHook onStart, FinishHook onFinish);
+
+    bool await_ready() const noexcept { return state->done; }
+    bool await_suspend(std::coroutine_handle<> handle);
+    MotorResult await_resume() const noexcept { return state->result; }
+
+private:
+    struct State {
+        bool done = false;
+        MotorResult result = MotorResult::Ok;
+        std::coroutine_handle<> handle;
+        QMetaObject::Connection responseConnection;
+        QMetaObject::Connection stopConnection;
+        QTimer *timer = nullptr;
+        FinishHook onFinish;
+    };
+
+    static void finish(const std::shared_ptr<State> &state, MotorResult result);
+
+    AsyncMotor *motor = nullptr;
+    QString command;
+    Matcher matcher;
+    StartHook onStart;
+    int timeoutMs = -1;
+    std::shared_ptr<State> state = std::make_shared<State>();
+};
+
+// SerialHandler 위의 코루틴 기반 모터 API
+//   MotorTask homing(AsyncMotor &motor) {
+//       if (co_await motor.connect("COM3") != MotorResult::Ok) co_return MotorResult::Failed;
+//       co_return co_await motor.move(60, 10);
+//   }
+// 모든 대기는 Qt 이벤트 루프에서 재개되며 스레드를 막지 않는다. 대기 중인 작업보다 오래 살아 있어야 한다.
+// 명령은 co_await 하는 시점에 전송된다. move/runFor 가 Timeout 으로 끝나면 제어기는 아직 돌고 있을 수
+// 있으므로 필요하면 stop() 을 호출한다. 이미 열린 SerialHandler 를 MainWindow 와 함께 써도 된다.
+// 단 그 상태에서 connect() 를 부르면 MainWindow 도 READY 를 받으므로 HI 전송, 시계 동기화 재시작,
+// 작업 재개 확인이 MainWindow 쪽에서 일어난다 (AsyncMotor 는 HI 를 보내지 않는다).
+class AsyncMotor : public QObject
+{
+    Q_OBJECT
+public:
+    static constexpr int NoTimeout = -1;
+
+    explicit AsyncMotor(SerialHandler *serial, QObject *parent = nullptr);
+
+    MotorAwaiter connect(const QString &portName, int timeoutMs = 3000);     // HELLO → READY (열려 있으면 포트 유지)
+    MotorAwaiter move(int rpm, int rotations, int timeoutMs = NoTimeout);    // 회전수 모드, DONE 까지
+    MotorAwaiter runFor(int rpm, int seconds, int timeoutMs = NoTimeout);    // 시간 모드, DONE 까지
+    MotorAwaiter waitProgress(int value, int timeoutMs = NoTimeout);         // TURN >= value 까지, 작업이 없으면 Failed
+    MotorAwaiter sleep(int ms);
+    void stop();    // STOP 전송, 대기 중인 작업은 MotorResult::Stopped 로 재개
+
+    const MotorControl &control() const;
+    SerialHandler *serialHandler() const;
+
+signals:
+    void responseReceived(const QString &line);
+    void stopRequested();
+
+private slots:
+    void handleData(const QString &data);
+
+private:
+    MotorAwaiter startJob(MotorMode mode, int rpm, int value, int timeoutMs);
+
+    SerialHandler *serial;
+    MotorControl motorControl;
+    bool isRunning = false;
+};
+
+#endif // ASYNCMOTOR_H
@@ -0,0 +1,63 @@
+#ifndef CLOCKSYNC_H
+#define CLOCKSYNC_H
+
+#include <QString>
+#include <QElapsedTimer>
+#include <deque>
+
+// PC ↔ ESP32 시계 동기화 (NTP 방식 4-타임스탬프 교환)
+//   PC → ESP32 : "PING:<t1>"
+//   ESP32 → PC : "PONG:<t1>:<t2>:<t3>"   (t2: 수신 시각, t3: 송신 시각, ESP32 µs)
+// 제어기 시각은 ctrl = host + offset + drift * (host - 기준시각) 모델로 추정한다.
+// 제어기 타임스탬프는 32비트 micros() (약 71분마다 0 으로 돌아감)와 64비트 esp_timer_get_time() 을
+// 모두 받으며, unwrapControllerTime() 으로 펼친 뒤 사용한다.
+class ClockSync
+{
+public:
+    ClockSync();
+
+    qint64 hostNowUs() const;                        // 호스트 단조 시계 (µs)
+    QString buildPing();
+    bool processPong(const QString &message, qint64 hostRecvUs); // true == PONG 메시지 처리됨
+    bool isPongOverdue() const;                      // 연속 MaxUnansweredPings 회 무응답 (PING 미지원 펌웨어)
+
+    // "TURN:3@123456" → body="TURN:3", ctrlUs=123456 (타임스탬프가 없으면 false)
+    static bool splitTimestamp(const QString &message, QString &body, qint64 &ctrlUs);
+
+    // 32비트 wrap 을 직전 타임스탬프 기준으로 펼친다 (수신 순서대로 호출, 35분 이내 간격 필요)
+    qint64 unwrapControllerTime(qint64 rawUs);
+
+    bool isSynced() const;
+    qint64 toHostTime(qint64 ctrlUs) const;          // 제어기 시각 → 호스트 시각
+    qint64 toHostDuration(qint64 ctrlDurationUs) const; // 제어기 시간 간격 → 호스트 시간 간격
+
+    double getOffsetUs() const;
+    double getDriftPpm() const;
+    qint64 getRoundTripUs() const;                   // 최소 왕복 지연
+    void reset();
+
+    static constexpr int MaxUnansweredPings = 5;
+
+private:
+    struct Sample {
+        qint64 hostMidUs;   // (t1 + t4) / 2
+        double offsetUs;    // ((t2 - t1) + (t3 - t4)) / 2
+        qint64 delayUs;     // (t4 - t1) - (t3 - t2)
+    };
+
+    void updateEstimate();
+
+    static constexpr int MaxSamples = 64;
+    static constexpr qint64 MinDriftSpanUs = 5000000; // 드리프트 추정 최소 관측 구간 (5초)
+
+    QElapsedTimer clock;
+    std::deque<Sample> samples;
+    double offsetUs = 0.0;
+    double drift = 0.0;     // 무차원 (ppm * 1e-6)
+    qint64 refHostUs = 0;
+    qint64 minDelayUs = 0;
+    qint64 lastCtrlUs = -1;     // 마지막으로 펼친 제어기 시각
+    int unansweredPings = 0;
+};
+
+#endif // CLOCKSYNC_H
@@ -0,0 +1,48 @@
+#ifndef JOBCHECKPOINT_H
+#define JOBCHECKPOINT_H
+
+#include <QElapsedTimer>
+#include <QString>
+#include "imotorcommand.h"
+
+struct JobState {
+    MotorMode mode = MotorMode::ROTATION;
+    int rpm = 0;
+    int target = 0;       // 전체 목표 (회전수 또는 초)
+    int completed = 0;    // 마지막으로 확인된 진행량 (target 과 같은 단위)
+};
+
+// 진행 중인 작업을 파일로 저장하여 연결이 끊긴 뒤 남은 작업만 재개할 수 있게 한다.
+// 저장은 QSaveFile(임시 파일 + rename)로 원자적으로 수행된다.
+// commit 마다 fsync 가 일어나므로 update() 는 interval 단위와 MinWriteIntervalMs 를 모두 넘었을 때만 저장한다.
+class JobCheckpoint
+{
+public:
+    explicit JobCheckpoint(const QString &filePath = defaultPath());
+
+    static QString defaultPath();
+
+    void begin(MotorMode mode, int rpm, int target, int alreadyCompleted = 0);
+    void update(int segmentCompleted);   // 현재 구동 구간의 진행량, interval 및 최소 시간 간격마다 저장
+    void flush();                        // 즉시 저장
+    void clear();                        // 작업 완료/정지 → 파일 삭제
+
+    bool load(JobState &out);            // 손상되었거나 끝난 작업의 파일은 삭제하고 false
+    bool isActive() const;
+    void setInterval(int units);
+
+    static constexpr int MinWriteIntervalMs = 5000;
+
+private:
+    bool write();
+
+    QString path;
+    JobState state;
+    int base = 0;           // 재개 이전에 완료된 진행량
+    int lastWritten = 0;
+    QElapsedTimer sinceWrite;
+    int interval = 10;
+    bool active = false;
+};
+
+#endif // JOBCHECKPOINT_H
@@ -1,68 +1,79 @@
-#ifndef MAINWINDOW_H
-#define MAINWINDOW_H
-
-#include <QMainWindow>
-#include <QTimer>
-#include <QDateTime>
-#include <QSerialPortInfo>
-#include <QString>
-#include <QMessageBox>
-#include "serialhandler.h"
-#include "motorcontrol.h"
-#include "motorcommandfactory.h"
-#include "imotorcommand.h"
-
-QT_BEGIN_NAMESPACE
-namespace Ui {
-class MainWindow;
-}
-QT_END_NAMESPACE
-
-class MainWindow : public QMainWindow
-{
-    Q_OBJECT
-
-public:
-    explicit MainWindow(QWidget *parent = nullptr);
-    ~MainWindow();
-
-private slots:
-    void updateDateTime();
-    void on_getButton_clicked();
-    void on_setButton_clicked();
-    void on_goButton_clicked();
-    void on_portComboBox_currentIndexChanged(const QString &portName);
-    void on_connectButton_clicked();
-    void on_rotationModeRadio_toggled(bool checked);
-    void on_timeModeRadio_toggled(bool checked);
-    void on_stopButton_clicked();
-
-    void handleSerialResponse(const QString &data);
-private:
-    Ui::MainWindow *ui;
-    QTimer *timer;
-    SerialHandler *serialHandler;
-    QString selectedPortName;
-
-
-    //내부 상태 관리용 변수
-    bool isSettingConfirmed;
-    int confirmedSpeed;
-    int confirmedValue;
-    MotorMode currentMode;
-    bool isMotorRunning;
-
-    MotorControl motorControl;
-
-    void populateSerialPorts();
-    void log(const QString &message);
-    void updateUIForMode(MotorMode mode);
-    void setUIEnabled(bool enabled);
-    void initializeTimeComboBoxes();
-    int getTotalSeconds() const;
-    void updateMotorStatus(const QString &status, const QString &color);
-
-
-
-};
-#endif // MAINWINDOW_H
+#ifndef MAINWINDOW_H
+#define MAINWINDOW_H
+
+#include <QMainWindow>
+#include <QTimer>
+#include <QDateTime>
+#include <QSerialPortInfo>
+#include <QString>
+#include <QMessageBox>
+#include "serialhandler.h"
+#include "motorcontrol.h"
+#include "motorcommandfactory.h"
+#include "imotorcommand.h"
+#include "motorsession.h"
+#include "telemetrywriter.h"
+
+QT_BEGIN_NAMESPACE
+namespace Ui {
+class MainWindow;
+}
+QT_END_NAMESPACE
+
+class MainWindow : public QMainWindow
+{
+    Q_OBJECT
+
+public:
+    explicit MainWindow(QWidget *parent = nullptr);
+    ~MainWindow();
+
+private slots:
+    void updateDateTime();
+    void on_getButton_clicked();
+    void on_setButton_clicked();
+    void on_goButton_clicked();
+    void on_portComboBox_currentIndexChanged(const QString &portName);
+    void on_connectButton_clicked();
+    void on_rotationModeRadio_toggled(bool checked);
+    void on_timeModeRadio_toggled(bool checked);
+    void on_stopButton_clicked();
+
+    void handleMotorConnected();
+    void updateMotorProgress(const QString &statusText, int progress);
+    void handleJobDone();
+    void handleJobStopped();
+    void handleMotorDisconnected(bool wasRunning);
+private:
+    Ui::MainWindow *ui;
+    QTimer *timer;
+    SerialHandler *serialHandler;
+    QString selectedPortName;
+
+
+    //내부 상태 관리용 변수
+    bool isSettingConfirmed;
+    int confirmedSpeed;
+    int confirmedValue;
+    MotorMode currentMode;
+
+    // 외부 프로세스용 공유 메모리 텔레메트리 (축 0)
+    TelemetryWriter telemetryWriter;
+
+    // 수신 처리, 시계 동기화, 작업 체크포인트 (위젯 갱신은 시그널로 받음)
+    MotorSession *motorSession;
+
+    void populateSerialPorts();
+    void log(const QString &message);
+    void updateUIForMode(MotorMode mode);
+    void setUIEnabled(bool enabled);
+    void initializeTimeComboBoxes();
+    int getTotalSeconds() const;
+    void updateMotorStatus(const QString &status, const QString &color);
+    void startMotor(int rpm, int value, int alreadyCompleted = 0);
+    void offerJobResume();
+
+
+
+};
+#endif // MAINWINDOW_H
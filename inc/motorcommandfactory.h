@@ -1,13 +1,13 @@
-#ifndef MOTORCOMMANDFACTORY_H
-#define MOTORCOMMANDFACTORY_H
-
-#include "imotorcommand.h"
-#include <memory>
-
-class MotorCommandFactory
-{
-public:
-    static std::unique_ptr<IMotorCommand> createCommand(MotorMode mode);
-};
-
+#ifndef MOTORCOMMANDFACTORY_H
+#define MOTORCOMMANDFACTORY_H
+
+#include "imotorcommand.h"
+#include <memory>
+
+class MotorCommandFactory
+{
+public:
+    static std::unique_ptr<IMotorCommand> createCommand(MotorMode mode);
+};
+
 #endif // MOTORCOMMANDFACTORY_H
\ No newline at end of file
@@ -17,9 +17,14 @@ public:
     bool isValidInput(int rpm, int value) const;
 
     void setTarget(int rpm, int value);
-    bool processResponse(const QString &message); // true == 연결 성공(READY)
+    // eventUs: 응답이 제어기에서 발생한 호스트 시각 (제어기 타임스탬프 변환값, 없으면 수신 시각)
+    bool processResponse(const QString &message, qint64 eventUs = -1); // true == 연결 성공(READY)
 
     int getProgress() const;
+    int getCurrentValue() const;   // 마지막으로 수신한 TURN 값
+    int getTargetValue() const;
+    int getRpm() const;
+    qint64 getLastEventUs() const; // 마지막 TURN/DONE/STOPPED 의 eventUs (-1 == 없음)
     QString getStatusMessage() const;
     void reset();
     MotorMode getCurrentMode() const;
@@ -29,6 +34,7 @@ private:
     int targetValue = 0;
     int currentProgress = 0;
     int rpm = 0;
+    qint64 lastEventUs = -1;
     QString status = "대기 중";
     bool isReady = false;
 };
@@ -0,0 +1,68 @@
+#ifndef MOTORSESSION_H
+#define MOTORSESSION_H
+
+#include <QObject>
+#include <QString>
+#include <QTimer>
+#include "clocksync.h"
+#include "jobcheckpoint.h"
+#include "motorcontrol.h"
+#include "serialhandler.h"
+#include "telemetrywriter.h"
+
+// 제어기 한 대의 수신 처리 (위젯 없음)
+// 시계 동기화, 타임스탬프 변환, 상태 갱신, 작업 체크포인트, 텔레메트리 게시를 맡고
+// 화면 갱신은 시그널로 넘긴다. MainWindow 와 부하 테스트가 같은 경로를 사용한다.
+class MotorSession : public QObject
+{
+    Q_OBJECT
+public:
+    // telemetry 가 nullptr 이면 게시하지 않는다. axis 는 telemetry 의 축 번호
+    MotorSession(SerialHandler *serial, TelemetryWriter *telemetry, int axis,
+                 const QString &checkpointPath = JobCheckpoint::defaultPath(), QObject *parent = nullptr);
+
+    MotorControl &control();
+    const MotorControl &control() const;
+    JobCheckpoint &checkpoint();
+    bool isRunning() const;
+
+    // 명령 전송 후 체크포인트 시작. 재개 시 alreadyCompleted 는 이전에 끝난 진행량
+    QString startJob(int rpm, int value, int alreadyCompleted = 0);
+    void stop();    // STOP 전송 - 사용자가 정지한 작업은 재개 대상이 아님
+
+public slots:
+    void handleResponse(const QString &data);
+
+signals:
+    void connected();                                        // READY 수신, HI 전송 및 시계 동기화 시작 후
+    void commandLatency(double ms);                          // ACK 의 제어기 시각 - 명령 전송 시각
+    void statusUpdated(const QString &statusText, int progress);
+    void jobDone();
+    void jobStopped();
+    void disconnected(bool wasRunning);                      // wasRunning 이면 체크포인트 저장됨
+    void clockSyncFailed();                                  // PONG 이 없어 PING 중단
+
+private slots:
+    void sendClockSyncPing();
+
+private:
+    int getCompletedValue() const;
+    void publishTelemetry(telemetry::AxisStatus status);
+    void publishEvent(telemetry::EventType type, qint64 eventUs = -1);   // eventUs: 호스트 단조 시각, -1 == 지금
+
+    SerialHandler *serial;
+    TelemetryWriter *telemetryWriter;
+    int axis;
+
+    MotorControl motorControl;
+    ClockSync clockSync;
+    JobCheckpoint jobCheckpoint;
+    QTimer syncTimer;
+    bool running = false;
+
+    qint64 commandSentUs = 0;   // 마지막 명령 전송 시각 (호스트 µs)
+    qint64 lastTurnCtrlUs = 0;  // 마지막 TURN 의 제어기 타임스탬프 (wrap 을 펼친 값)
+    qint64 jobStartUs = 0;
+};
+
+#endif // MOTORSESSION_H
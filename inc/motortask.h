@@ -0,0 +1,81 @@
+#ifndef MOTORTASK_H
+#define MOTORTASK_H
+
+#include <coroutine>
+#include <exception>
+#include <functional>
+#include <memory>
+
+enum class MotorResult {
+    Ok,
+    Timeout,
+    Stopped,        // STOP 요청 또는 STOPPED 수신
+    Disconnected,   // ESP32 DISCONNECTED
+    Failed          // 포트 열기 실패, 잘못된 입력 등
+};
+
+// AsyncMotor 시퀀스용 코루틴 반환 타입
+// 호출 즉시 실행되며 Qt 이벤트 루프에서 재개된다. 다른 MotorTask 안에서 co_await 할 수 있다.
+class MotorTask
+{
+    struct State {
+        bool done = false;
+        MotorResult result = MotorResult::Ok;
+        std::coroutine_handle<> continuation;
+        std::function<void(MotorResult)> onFinished;
+    };
+
+public:
+    struct promise_type {
+        std::shared_ptr<State> state = std::make_shared<State>();
+
+        MotorTask get_return_object() { return MotorTask(state); }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+
+        // 완료 시 프레임을 정리하고 기다리던 쪽을 이어서 실행
+        struct FinalAwaiter {
+            bool await_ready() const noexcept { return false; }
+            void await_suspend(std::coroutine_handle<promise_type> handle) noexcept
+            {
+                std::shared_ptr<State> finished = handle.promise().state;
+                handle.destroy();
+                finished->done = true;
+                if (finished->onFinished) {
+                    finished->onFinished(finished->result);
+                }
+                if (finished->continuation) {
+                    finished->continuation.resume();
+                }
+            }
+            void await_resume() const noexcept {}
+        };
+        FinalAwaiter final_suspend() noexcept { return {}; }
+
+        void return_value(MotorResult result) { state->result = result; }
+        void unhandled_exception() { std::terminate(); }
+    };
+
+    bool isDone() const { return state->done; }
+    MotorResult result() const { return state->result; }
+
+    // 완료 콜백 (이미 완료된 경우 즉시 호출)
+    void then(std::function<void(MotorResult)> callback)
+    {
+        if (state->done) {
+            callback(state->result);
+        } else {
+            state->onFinished = std::move(callback);
+        }
+    }
+
+    bool await_ready() const noexcept { return state->done; }
+    void await_suspend(std::coroutine_handle<> handle) noexcept { state->continuation = handle; }
+    MotorResult await_resume() const noexcept { return state->result; }
+
+private:
+    explicit MotorTask(std::shared_ptr<State> taskState) : state(std::move(taskState)) {}
+
+    std::shared_ptr<State> state;
+};
+
+#endif // MOTORTASK_H
@@ -1,30 +1,33 @@
-#ifndef SERIALHANDLER_H
-#define SERIALHANDLER_H
-
-#include <QObject>
-#include <QSerialPort>
-
-class SerialHandler : public QObject
-{
-    Q_OBJECT
-public:
-    explicit SerialHandler(QObject *parent=nullptr);
-    ~SerialHandler();
-
-    bool openSerialPort(const QString &portName, qint32 baudRate = QSerialPort::Baud115200);
-    void sendCommand(const QString &command);
-    void sendData(const QString &data);
-    bool isOpen() const;
-
-signals:
-    void dataReceived(const QString &data);  // 수신된 데이터가 있을 때 signal
-
-private slots:
-    void handleReadyRead();
-    void handleError(QSerialPort::SerialPortError error);
-
-private:
-    QSerialPort *serial;
-};
-
-#endif // SERIALHANDLER_H
+#ifndef SERIALHANDLER_H
+#define SERIALHANDLER_H
+
+#include <QObject>
+#include <QSerialPort>
+
+class SerialHandler : public QObject
+{
+    Q_OBJECT
+public:
+    explicit SerialHandler(QObject *parent=nullptr);
+    ~SerialHandler();
+
+    bool openSerialPort(const QString &portName, qint32 baudRate = QSerialPort::Baud115200);
+    void sendCommand(const QString &command);
+    void sendData(const QString &data);
+    bool isOpen() const;
+
+signals:
+    void dataReceived(const QString &data);  // 수신된 한 줄(응답 하나)마다 signal
+
+private slots:
+    void handleReadyRead();
+    void handleError(QSerialPort::SerialPortError error);
+
+private:
+    static constexpr int MaxLineLength = 1024;
+
+    QSerialPort *serial;
+    QByteArray readBuffer;   // 아직 줄바꿈을 받지 못한 응답 조각
+};
+
+#endif // SERIALHANDLER_H
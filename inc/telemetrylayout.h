@@ -0,0 +1,126 @@
+#ifndef TELEMETRYLAYOUT_H
+#define TELEMETRYLAYOUT_H
+
+// 공유 메모리 텔레메트리 레이아웃 (writer: stepperESP32, reader: tools/telemetry)
+// Qt 에 의존하지 않으므로 외부 프로세스에서 그대로 include 할 수 있다.
+//
+// - 단일 writer, 다수 reader. reader 는 PROT_READ 로 매핑만 하고 공유 메모리에 쓰지 않는다.
+// - 축 상태와 이벤트 슬롯은 seqlock 으로 보호된다 (홀수 = 쓰는 중).
+// - 이벤트 링은 가득 차면 가장 오래된 슬롯을 덮어쓴다. 느린 reader 는 누락 수로 알 수 있다.
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace telemetry {
+
+constexpr const char *DefaultName = "/stepper_telemetry";
+constexpr uint32_t Magic = 0x4D544C4D;     // "MTLM"
+constexpr uint32_t Version = 1;
+constexpr uint32_t MaxAxes = 8;
+constexpr uint32_t EventCapacity = 4096;   // 2의 거듭제곱
+
+enum class AxisStatus : uint32_t {
+    Idle = 0,
+    Connected,
+    Running,
+    Done,
+    Stopped,
+    Disconnected
+};
+
+enum class EventType : uint32_t {
+    Started = 1,
+    Turn,
+    Done,
+    Stopped,
+    Disconnected
+};
+
+struct alignas(64) AxisRecord {
+    std::atomic<uint64_t> seq;
+    std::atomic<uint32_t> status;
+    std::atomic<int32_t> mode;          // 0 = ROTATION, 1 = TIME
+    std::atomic<int32_t> rpm;
+    std::atomic<int32_t> target;
+    std::atomic<int32_t> progress;      // 마지막 TURN 값
+    std::atomic<int32_t> percent;
+    std::atomic<int64_t> updatedUs;     // Unix epoch µs
+};
+
+struct alignas(32) EventRecord {
+    std::atomic<uint64_t> seq;          // 2*index+1: 쓰는 중, 2*index+2: 완료
+    std::atomic<int64_t> timestampUs;   // Unix epoch µs (TURN/DONE/STOPPED 는 제어기 시각을 변환한 발생 시각)
+    std::atomic<uint16_t> axis;
+    std::atomic<uint16_t> type;
+    std::atomic<int32_t> value;
+    std::atomic<int32_t> target;
+};
+
+struct Header {
+    std::atomic<uint32_t> magic;        // 초기화가 끝난 뒤 마지막으로 기록
+    uint32_t version;
+    uint32_t maxAxes;
+    uint32_t eventCapacity;
+    std::atomic<uint32_t> axisCount;
+    std::atomic<uint64_t> writeIndex;   // 다음에 기록할 이벤트 번호
+    AxisRecord axes[MaxAxes];
+    EventRecord events[EventCapacity];
+};
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "공유 메모리에는 lock-free atomic 이 필요합니다");
+
+// reader 가 복사해 가는 값
+struct AxisSnapshot {
+    AxisStatus status = AxisStatus::Idle;
+    int32_t mode = 0;
+    int32_t rpm = 0;
+    int32_t target = 0;
+    int32_t progress = 0;
+    int32_t percent = 0;
+    int64_t updatedUs = 0;
+};
+
+struct EventSnapshot {
+    uint64_t index = 0;
+    int64_t timestampUs = 0;
+    uint16_t axis = 0;
+    EventType type = EventType::Turn;
+    int32_t value = 0;
+    int32_t target = 0;
+};
+
+inline int64_t nowUs()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+inline const char *statusName(AxisStatus status)
+{
+    switch (status) {
+    case AxisStatus::Idle:         return "IDLE";
+    case AxisStatus::Connected:    return "CONNECTED";
+    case AxisStatus::Running:      return "RUNNING";
+    case AxisStatus::Done:         return "DONE";
+    case AxisStatus::Stopped:      return "STOPPED";
+    case AxisStatus::Disconnected: return "DISCONNECTED";
+    }
+    return "UNKNOWN";
+}
+
+inline const char *eventName(EventType type)
+{
+    switch (type) {
+    case EventType::Started:      return "STARTED";
+    case EventType::Turn:         return "TURN";
+    case EventType::Done:         return "DONE";
+    case EventType::Stopped:      return "STOPPED";
+    case EventType::Disconnected: return "DISCONNECTED";
+    }
+    return "UNKNOWN";
+}
+
+} // namespace telemetry
+
+#endif // TELEMETRYLAYOUT_H
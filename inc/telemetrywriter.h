@@ -0,0 +1,32 @@
+#ifndef TELEMETRYWRITER_H
+#define TELEMETRYWRITER_H
+
+#include "imotorcommand.h"
+#include "telemetrylayout.h"
+
+// 모터 상태와 TURN/DONE/STOPPED 이벤트를 POSIX 공유 메모리로 게시 (단일 writer)
+// 기록은 atomic store 몇 개뿐이며 reader 수와 무관하게 시리얼 경로를 막지 않는다.
+// 단일 writer 는 공유 메모리 fd 의 flock 으로 보장하며, 다른 인스턴스가 게시 중이면 게시하지 않는다.
+// POSIX 공유 메모리가 없는 플랫폼에서는 아무 동작도 하지 않는다.
+class TelemetryWriter
+{
+public:
+    explicit TelemetryWriter(const char *name = telemetry::DefaultName);
+    ~TelemetryWriter();
+
+    bool isOpen() const;
+
+    void updateAxis(int axis, telemetry::AxisStatus status, MotorMode mode,
+                    int rpm, int target, int progress, int percent);
+    // timestampUs: 이벤트가 발생한 시각 (Unix epoch µs, 0 이면 게시 시각)
+    void publishEvent(int axis, telemetry::EventType type, int value, int target, int64_t timestampUs = 0);
+
+    TelemetryWriter(const TelemetryWriter &) = delete;
+    TelemetryWriter &operator=(const TelemetryWriter &) = delete;
+
+private:
+    telemetry::Header *shared = nullptr;
+    int lockFd = -1;   // 살아 있는 동안 flock(LOCK_EX) 유지
+};
+
+#endif // TELEMETRYWRITER_H
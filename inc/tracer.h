@@ -0,0 +1,84 @@
+#ifndef TRACER_H
+#define TRACER_H
+
+#include <QString>
+#include <atomic>
+
+// Chrome trace-event (Perfetto / chrome://tracing) 기록기
+// 비활성 상태에서는 TRACE_* 매크로가 분기 하나만 수행한다.
+enum class TraceTrack {
+    SerialIO,   // 시리얼 송수신
+    Parsing,    // 명령 생성 / 응답 해석
+    UI          // 버튼 클릭, 위젯 갱신
+};
+
+class Tracer
+{
+public:
+    static bool isEnabled() { return enabled.load(std::memory_order_relaxed); }
+
+    static void start();    // 이전 기록을 비운다. 다른 스레드가 기록 중이 아닐 때(정지 상태) 호출
+    static void stop();
+    static bool writeJson(const QString &path);   // 기록된 이벤트를 trace-event JSON 으로 저장
+
+    static qint64 nowUs();
+    static void complete(TraceTrack track, const char *name, qint64 startUs, qint64 durUs, const QString &arg = QString());
+    static void instant(TraceTrack track, const char *name, const QString &arg = QString());
+
+private:
+    static std::atomic<bool> enabled;
+};
+
+// 범위(시작~끝)를 하나의 complete 이벤트로 기록
+class TraceScope
+{
+public:
+    TraceScope(TraceTrack scopeTrack, const char *scopeName)
+        : track(scopeTrack), name(scopeName), startUs(Tracer::isEnabled() ? Tracer::nowUs() : -1) {}
+
+    // argFn 은 트레이싱이 켜져 있을 때만 호출된다
+    template <typename ArgFn>
+    TraceScope(TraceTrack scopeTrack, const char *scopeName, ArgFn &&argFn)
+        : TraceScope(scopeTrack, scopeName)
+    {
+        if (startUs >= 0) {
+            arg = argFn();
+        }
+    }
+
+    ~TraceScope()
+    {
+        if (startUs >= 0) {
+            Tracer::complete(track, name, startUs, Tracer::nowUs() - startUs, arg);
+        }
+    }
+
+    bool isActive() const { return startUs >= 0; }
+
+    TraceScope(const TraceScope &) = delete;
+    TraceScope &operator=(const TraceScope &) = delete;
+
+private:
+    TraceTrack track;
+    const char *name;
+    qint64 startUs;
+    QString arg;
+};
+
+#define TRACE_CONCAT_IMPL(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_IMPL(a, b)
+
+#define TRACE_SCOPE(track, name) \
+    TraceScope TRACE_CONCAT(traceScope_, __LINE__)(track, name)
+
+// arg 는 트레이싱이 켜져 있을 때만 평가된다
+#define TRACE_SCOPE_ARG(track, name, arg) \
+    TraceScope TRACE_CONCAT(traceScope_, __LINE__)(track, name, [&]() -> QString { return (arg); })
+
+#define TRACE_INSTANT(track, name) \
+    do { if (Tracer::isEnabled()) Tracer::instant(track, name); } while (0)
+
+#define TRACE_INSTANT_ARG(track, name, arg) \
+    do { if (Tracer::isEnabled()) Tracer::instant(track, name, arg); } while (0)
+
+#endif // TRACER_H
@@ -1,11 +1,28 @@
-#include "mainwindow.h"
-
-#include <QApplication>
-
-int main(int argc, char *argv[])
-{
-    QApplication a(argc, argv);
-    MainWindow w;
-    w.show();
-    return a.exec();
-}
+#include "mainwindow.h"
+#include "tracer.h"
+
+#include <QApplication>
+
+int main(int argc, char *argv[])
+{
+    QApplication a(argc, argv);
+
+    // STEPPER_TRACE=<파일경로> 로 실행하면 종료 시 trace-event JSON 저장
+    const QString tracePath = qEnvironmentVariable("STEPPER_TRACE");
+    if (!tracePath.isEmpty()) {
+        Tracer::start();
+    }
+
+    int result;
+    {
+        MainWindow w;
+        w.show();
+        result = a.exec();
+    }
+
+    if (!tracePath.isEmpty()) {
+        Tracer::stop();
+        Tracer::writeJson(tracePath);
+    }
+    return result;
+}
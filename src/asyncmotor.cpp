@@ -0,0 +1,228 @@
+#include "asyncmotor.h"
+#include "clocksync.h"
+#include "motorcommandfactory.h"
+#include <QDebug>
+#include <QTimer>
+
+MotorAwaiter::MotorAwaiter(AsyncMotor *motor, const QString &command, Matcher matcher, int timeoutMs)
+    : motor(motor)
+    , command(command)
+    , matcher(std::move(matcher))
+    , timeoutMs(timeoutMs)
+{
+}
+
+MotorAwaiter::MotorAwaiter(MotorResult immediate)
+{
+    state->done = true;
+    state->result = immediate;
+}
+
+void MotorAwaiter::setHooks(StartHook start, FinishHook finish)
+{
+    onStart = std::move(start);
+    state->onFinish = std::move(finish);
+}
+
+bool MotorAwaiter::await_suspend(std::coroutine_handle<> handle)
+{
+    if (onStart && !onStart()) {
+        state->done = true;
+        state->result = MotorResult::Failed;
+        return false;
+    }
+
+    state->handle = handle;
+    std::shared_ptr<State> pending = state;
+
+    if (matcher) {
+        Matcher match = matcher;
+        state->responseConnection = QObject::connect(motor, &AsyncMotor::responseReceived, motor,
+                                                     [pending, match](const QString &line) {
+            if (line == "ESP32 DISCONNECTED") {
+                finish(pending, MotorResult::Disconnected);
+            } else if (std::optional<MotorResult> result = match(line)) {
+                finish(pending, *result);
+            }
+        });
+    }
+    state->stopConnection = QObject::connect(motor, &AsyncMotor::stopRequested, motor, [pending]() {
+        finish(pending, MotorResult::Stopped);
+    });
+
+    if (timeoutMs >= 0) {
+        // matcher 가 없는 대기(sleep)는 시간이 다 되면 정상 완료
+        const MotorResult expired = matcher ? MotorResult::Timeout : MotorResult::Ok;
+        state->timer = new QTimer(motor);
+        state->timer->setSingleShot(true);
+        QObject::connect(state->timer, &QTimer::timeout, motor, [pending, expired]() {
+            finish(pending, expired);
+        });
+        state->timer->start(timeoutMs);
+    }
+
+    // 응답 대기 연결 후 전송해야 빠른 응답을 놓치지 않는다
+    if (!command.isEmpty()) {
+        motor->serialHandler()->sendCommand(command);
+    }
+    return true;
+}
+
+void MotorAwaiter::finish(const std::shared_ptr<State> &state, MotorResult result)
+{
+    if (state->done) {
+        return;
+    }
+    state->done = true;
+    state->result = result;
+    QObject::disconnect(state->responseConnection);
+    QObject::disconnect(state->stopConnection);
+    if (state->timer) {
+        state->timer->stop();
+        state->timer->deleteLater();
+        state->timer = nullptr;
+    }
+    if (state->onFinish) {
+        state->onFinish(result);
+    }
+    state->handle.resume();
+}
+
+AsyncMotor::AsyncMotor(SerialHandler *serial, QObject *parent)
+    : QObject(parent)
+    , serial(serial)
+{
+    QObject::connect(serial, &SerialHandler::dataReceived, this, &AsyncMotor::handleData);
+}
+
+void AsyncMotor::handleData(const QString &data)
+{
+    // SerialHandler 가 한 줄씩 전달한다. "TURN:3@<µs>" 의 제어기 타임스탬프는 떼고 처리
+    QString line;
+    qint64 ctrlUs = 0;
+    ClockSync::splitTimestamp(data.trimmed(), line, ctrlUs);
+    if (line.isEmpty()) {
+        return;
+    }
+
+    motorControl.processResponse(line);
+    if (line == "DONE" || line == "STOPPED" || line == "ESP32 DISCONNECTED") {
+        isRunning = false;
+    }
+    emit responseReceived(line);
+}
+
+MotorAwaiter AsyncMotor::connect(const QString &portName, int timeoutMs)
+{
+    // MainWindow 등이 이미 연 포트는 다시 열지 않고 핸드셰이크만 수행.
+    // 그 경우 READY 는 포트 주인(MotorSession)도 받아 HI 를 보내므로 여기서는 보내지 않는다
+    const bool sharedPort = serial->isOpen();
+    if (!sharedPort && (portName.isEmpty() || !serial->openSerialPort(portName))) {
+        qDebug() << "포트 열기 실패:" << portName;
+        return MotorAwaiter(MotorResult::Failed);
+    }
+
+    SerialHandler *handler = serial;
+    return MotorAwaiter(this, "HELLO\n", [handler, sharedPort](const QString &line) -> std::optional<MotorResult> {
+        if (line == "READY") {
+            if (!sharedPort) {
+                handler->sendCommand("HI");
+            }
+            return MotorResult::Ok;
+        }
+        return std::nullopt;
+    }, timeoutMs);
+}
+
+MotorAwaiter AsyncMotor::move(int rpm, int rotations, int timeoutMs)
+{
+    return startJob(MotorMode::ROTATION, rpm, rotations, timeoutMs);
+}
+
+MotorAwaiter AsyncMotor::runFor(int rpm, int seconds, int timeoutMs)
+{
+    return startJob(MotorMode::TIME, rpm, seconds, timeoutMs);
+}
+
+MotorAwaiter AsyncMotor::startJob(MotorMode mode, int rpm, int value, int timeoutMs)
+{
+    if (!serial->isOpen() || isRunning) {
+        return MotorAwaiter(MotorResult::Failed);
+    }
+
+    const std::unique_ptr<IMotorCommand> strategy = MotorCommandFactory::createCommand(mode);
+    if (!strategy->isValidInput(rpm, value)) {
+        return MotorAwaiter(MotorResult::Failed);
+    }
+
+    MotorAwaiter awaiter(this, strategy->buildCommand(rpm, value), [](const QString &line) -> std::optional<MotorResult> {
+        if (line == "DONE") {
+            return MotorResult::Ok;
+        }
+        if (line == "STOPPED") {
+            return MotorResult::Stopped;
+        }
+        return std::nullopt;
+    }, timeoutMs);
+
+    // 실행 상태는 실제로 전송할 때 설정하고, 결과와 관계없이(Timeout 포함) 해제한다
+    awaiter.setHooks([this, mode, rpm, value]() {
+        if (isRunning || !serial->isOpen()) {
+            return false;
+        }
+        motorControl.setCommandStrategy(MotorCommandFactory::createCommand(mode));
+        motorControl.setTarget(rpm, value);
+        isRunning = true;
+        return true;
+    }, [this](MotorResult) {
+        isRunning = false;
+    });
+    return awaiter;
+}
+
+MotorAwaiter AsyncMotor::waitProgress(int value, int timeoutMs)
+{
+    // 끝난 작업의 진행 값으로 성공하지 않도록 실행 여부를 먼저 확인
+    if (!isRunning) {
+        return MotorAwaiter(MotorResult::Failed);
+    }
+    if (motorControl.getCurrentValue() >= value) {
+        return MotorAwaiter(MotorResult::Ok);
+    }
+
+    const MotorControl *control = &motorControl;
+    return MotorAwaiter(this, QString(), [control, value](const QString &line) -> std::optional<MotorResult> {
+        if (line.startsWith("TURN:") && control->getCurrentValue() >= value) {
+            return MotorResult::Ok;
+        }
+        if (line == "DONE") {
+            return control->getCurrentValue() >= value ? MotorResult::Ok : MotorResult::Failed;
+        }
+        if (line == "STOPPED") {
+            return MotorResult::Stopped;
+        }
+        return std::nullopt;
+    }, timeoutMs);
+}
+
+MotorAwaiter AsyncMotor::sleep(int ms)
+{
+    return MotorAwaiter(this, QString(), MotorAwaiter::Matcher(), qMax(0, ms));
+}
+
+void AsyncMotor::stop()
+{
+    serial->sendCommand("STOP");
+    isRunning = false;
+    emit stopRequested();
+}
+
+const MotorControl &AsyncMotor::control() const
+{
+    return motorControl;
+}
+
+SerialHandler *AsyncMotor::serialHandler() const
+{
+    return serial;
+}
@@ -0,0 +1,208 @@
+#include "clocksync.h"
+#include <QDebug>
+#include <QStringList>
+#include <algorithm>
+#include <vector>
+
+ClockSync::ClockSync()
+{
+    clock.start();
+}
+
+qint64 ClockSync::hostNowUs() const
+{
+    return clock.nsecsElapsed() / 1000;
+}
+
+QString ClockSync::buildPing()
+{
+    ++unansweredPings;
+    return QString("PING:%1\n").arg(hostNowUs());
+}
+
+bool ClockSync::isPongOverdue() const
+{
+    return unansweredPings >= MaxUnansweredPings;
+}
+
+bool ClockSync::processPong(const QString &message, qint64 hostRecvUs)
+{
+    if (!message.startsWith("PONG:")) {
+        return false;
+    }
+
+    const QStringList parts = message.split(':');
+    if (parts.size() != 4) {
+        qDebug() << "잘못된 PONG 메시지:" << message;
+        return true;
+    }
+
+    bool ok1 = false, ok2 = false, ok3 = false;
+    const qint64 t1 = parts[1].toLongLong(&ok1);
+    const qint64 rawT2 = parts[2].toLongLong(&ok2);
+    const qint64 rawT3 = parts[3].toLongLong(&ok3);
+    const qint64 t4 = hostRecvUs;
+    if (!ok1 || !ok2 || !ok3 || t4 < t1) {
+        qDebug() << "잘못된 PONG 메시지:" << message;
+        return true;
+    }
+    const qint64 t2 = unwrapControllerTime(rawT2);
+    const qint64 t3 = unwrapControllerTime(rawT3);
+    if (t3 < t2) {
+        qDebug() << "잘못된 PONG 메시지:" << message;
+        return true;
+    }
+    unansweredPings = 0;
+
+    Sample sample;
+    sample.hostMidUs = t1 + (t4 - t1) / 2;
+    sample.offsetUs = ((t2 - t1) + (t3 - t4)) / 2.0;
+    sample.delayUs = std::max<qint64>(0, (t4 - t1) - (t3 - t2));
+
+    samples.push_back(sample);
+    if (samples.size() > MaxSamples) {
+        samples.pop_front();
+    }
+    updateEstimate();
+    return true;
+}
+
+bool ClockSync::splitTimestamp(const QString &message, QString &body, qint64 &ctrlUs)
+{
+    const int at = message.lastIndexOf('@');
+    if (at < 0) {
+        body = message;
+        return false;
+    }
+
+    bool ok = false;
+    const qint64 stamp = message.mid(at + 1).trimmed().toLongLong(&ok);
+    if (!ok) {
+        body = message;
+        return false;
+    }
+
+    body = message.left(at).trimmed();
+    ctrlUs = stamp;
+    return true;
+}
+
+qint64 ClockSync::unwrapControllerTime(qint64 rawUs)
+{
+    constexpr qint64 Wrap = qint64(1) << 32;
+    if (rawUs < 0) {
+        return rawUs;
+    }
+    if (lastCtrlUs < 0) {
+        lastCtrlUs = rawUs;
+        return rawUs;
+    }
+
+    // 직전 값과 가장 가까운 2^32 주기를 고른다 (64비트 값은 상위 비트가 같아 그대로 유지)
+    qint64 unwrapped = (lastCtrlUs - lastCtrlUs % Wrap) + rawUs % Wrap;
+    if (unwrapped < lastCtrlUs - Wrap / 2) {
+        unwrapped += Wrap;
+    } else if (unwrapped > lastCtrlUs + Wrap / 2) {
+        unwrapped -= Wrap;
+    }
+    lastCtrlUs = std::max(lastCtrlUs, unwrapped);
+    return unwrapped;
+}
+
+void ClockSync::updateEstimate()
+{
+    if (samples.empty()) {
+        return;
+    }
+
+    // 지연이 작은 절반의 샘플만 사용 (USB 버퍼링으로 지연된 샘플 제외)
+    std::vector<qint64> delays;
+    delays.reserve(samples.size());
+    for (const Sample &s : samples) {
+        delays.push_back(s.delayUs);
+    }
+    std::sort(delays.begin(), delays.end());
+    minDelayUs = delays.front();
+    const qint64 medianDelay = delays[delays.size() / 2];
+
+    std::vector<const Sample *> good;
+    for (const Sample &s : samples) {
+        if (s.delayUs <= medianDelay) {
+            good.push_back(&s);
+        }
+    }
+
+    const qint64 span = good.back()->hostMidUs - good.front()->hostMidUs;
+    if (good.size() >= 2 && span >= MinDriftSpanUs) {
+        // 최소자승 직선 근사: offset = a + drift * (host - ref)
+        double meanX = 0.0, meanY = 0.0;
+        for (const Sample *s : good) {
+            meanX += s->hostMidUs;
+            meanY += s->offsetUs;
+        }
+        meanX /= good.size();
+        meanY /= good.size();
+
+        double sxx = 0.0, sxy = 0.0;
+        for (const Sample *s : good) {
+            const double dx = s->hostMidUs - meanX;
+            sxx += dx * dx;
+            sxy += dx * (s->offsetUs - meanY);
+        }
+
+        refHostUs = static_cast<qint64>(meanX);
+        offsetUs = meanY;
+        drift = (sxx > 0.0) ? sxy / sxx : 0.0;
+    } else {
+        const Sample *best = good.front();
+        for (const Sample *s : good) {
+            if (s->delayUs < best->delayUs) {
+                best = s;
+            }
+        }
+        refHostUs = best->hostMidUs;
+        offsetUs = best->offsetUs;
+    }
+}
+
+bool ClockSync::isSynced() const
+{
+    return !samples.empty();
+}
+
+qint64 ClockSync::toHostTime(qint64 ctrlUs) const
+{
+    // ctrl = host + offset + drift * (host - ref)
+    return static_cast<qint64>((ctrlUs - offsetUs + drift * refHostUs) / (1.0 + drift));
+}
+
+qint64 ClockSync::toHostDuration(qint64 ctrlDurationUs) const
+{
+    return static_cast<qint64>(ctrlDurationUs / (1.0 + drift));
+}
+
+double ClockSync::getOffsetUs() const
+{
+    return offsetUs;
+}
+
+double ClockSync::getDriftPpm() const
+{
+    return drift * 1e6;
+}
+
+qint64 ClockSync::getRoundTripUs() const
+{
+    return minDelayUs;
+}
+
+void ClockSync::reset()
+{
+    samples.clear();
+    offsetUs = 0.0;
+    drift = 0.0;
+    refHostUs = 0;
+    minDelayUs = 0;
+    lastCtrlUs = -1;
+    unansweredPings = 0;
+}
@@ -0,0 +1,131 @@
+#include "jobcheckpoint.h"
+#include <QDebug>
+#include <QDir>
+#include <QFile>
+#include <QSaveFile>
+#include <QStandardPaths>
+#include <QStringList>
+
+JobCheckpoint::JobCheckpoint(const QString &filePath)
+    : path(filePath)
+{
+}
+
+QString JobCheckpoint::defaultPath()
+{
+    QString dir = QStandardPaths::writableLocation(QStandardPaths::AppLocalDataLocation);
+    if (dir.isEmpty()) {
+        dir = QDir::tempPath();
+    }
+    QDir().mkpath(dir);
+    return QDir(dir).filePath("job_checkpoint.txt");
+}
+
+void JobCheckpoint::begin(MotorMode mode, int rpm, int target, int alreadyCompleted)
+{
+    state.mode = mode;
+    state.rpm = rpm;
+    state.target = target;
+    state.completed = alreadyCompleted;
+    base = alreadyCompleted;
+    lastWritten = alreadyCompleted;
+    active = true;
+    write();
+}
+
+void JobCheckpoint::update(int segmentCompleted)
+{
+    if (!active) {
+        return;
+    }
+    state.completed = qMin(base + segmentCompleted, state.target);
+    // 시리얼 수신 경로에서 호출되므로 높은 RPM 에서도 몇 초에 한 번만 fsync
+    if (state.completed - lastWritten >= interval
+        && (!sinceWrite.isValid() || sinceWrite.elapsed() >= MinWriteIntervalMs)) {
+        write();
+    }
+}
+
+void JobCheckpoint::flush()
+{
+    if (active) {
+        write();
+    }
+}
+
+void JobCheckpoint::clear()
+{
+    active = false;
+    QFile::remove(path);
+}
+
+bool JobCheckpoint::load(JobState &out)
+{
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+
+    JobState loaded;
+    bool hasMode = false, hasRpm = false, hasTarget = false, hasCompleted = false;
+    const QStringList lines = QString::fromUtf8(file.readAll()).split('\n');
+    file.close();
+    for (const QString &line : lines) {
+        const QString key = line.section('=', 0, 0).trimmed();
+        const QString value = line.section('=', 1).trimmed();
+        if (key == "mode") {
+            hasMode = (value == "TIME" || value == "ROTATION");
+            loaded.mode = (value == "TIME") ? MotorMode::TIME : MotorMode::ROTATION;
+        } else if (key == "rpm") {
+            loaded.rpm = value.toInt(&hasRpm);
+        } else if (key == "target") {
+            loaded.target = value.toInt(&hasTarget);
+        } else if (key == "completed") {
+            loaded.completed = value.toInt(&hasCompleted);
+        }
+    }
+
+    // 음수 진행량은 남은 양을 원래 목표보다 크게 만들므로 거부
+    if (!hasMode || !hasRpm || !hasTarget || !hasCompleted
+        || loaded.rpm <= 0 || loaded.target <= 0
+        || loaded.completed < 0 || loaded.completed >= loaded.target) {
+        qDebug() << "재개할 수 없는 체크포인트 삭제:" << path;
+        QFile::remove(path);
+        return false;
+    }
+    out = loaded;
+    return true;
+}
+
+bool JobCheckpoint::isActive() const
+{
+    return active;
+}
+
+void JobCheckpoint::setInterval(int units)
+{
+    interval = qMax(1, units);
+}
+
+bool JobCheckpoint::write()
+{
+    QSaveFile file(path);
+    if (!file.open(QIODevice::WriteOnly)) {
+        qDebug() << "체크포인트 저장 실패:" << path;
+        return false;
+    }
+
+    const QString text = QString("mode=%1\nrpm=%2\ntarget=%3\ncompleted=%4\n")
+                             .arg(state.mode == MotorMode::TIME ? "TIME" : "ROTATION")
+                             .arg(state.rpm)
+                             .arg(state.target)
+                             .arg(state.completed);
+    file.write(text.toUtf8());
+    if (!file.commit()) {
+        qDebug() << "체크포인트 저장 실패:" << path;
+        return false;
+    }
+    lastWritten = state.completed;
+    sinceWrite.start();
+    return true;
+}
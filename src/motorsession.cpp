@@ -0,0 +1,197 @@
+#include "motorsession.h"
+#include "tracer.h"
+#include <QDebug>
+
+MotorSession::MotorSession(SerialHandler *serial, TelemetryWriter *telemetry, int axis,
+                           const QString &checkpointPath, QObject *parent)
+    : QObject(parent)
+    , serial(serial)
+    , telemetryWriter(telemetry)
+    , axis(axis)
+    , jobCheckpoint(checkpointPath)
+{
+    connect(serial, &SerialHandler::dataReceived, this, &MotorSession::handleResponse);
+
+    // 연결 후 주기적으로 PING 을 보내 시계 오프셋/드리프트 추정
+    connect(&syncTimer, &QTimer::timeout, this, &MotorSession::sendClockSyncPing);
+}
+
+MotorControl &MotorSession::control()
+{
+    return motorControl;
+}
+
+const MotorControl &MotorSession::control() const
+{
+    return motorControl;
+}
+
+JobCheckpoint &MotorSession::checkpoint()
+{
+    return jobCheckpoint;
+}
+
+bool MotorSession::isRunning() const
+{
+    return running;
+}
+
+QString MotorSession::startJob(int rpm, int value, int alreadyCompleted)
+{
+    QString command = motorControl.buildCommand(rpm, value);
+    motorControl.setTarget(rpm, value);
+    serial->sendCommand(command);
+    commandSentUs = clockSync.hostNowUs();
+    jobStartUs = commandSentUs;
+    lastTurnCtrlUs = 0;
+    running = true;
+
+    jobCheckpoint.begin(motorControl.getCurrentMode(), rpm, alreadyCompleted + value, alreadyCompleted);
+    publishTelemetry(telemetry::AxisStatus::Running);
+    publishEvent(telemetry::EventType::Started);
+    return command;
+}
+
+void MotorSession::stop()
+{
+    jobCheckpoint.clear();
+    serial->sendCommand("STOP");
+    running = false;
+}
+
+void MotorSession::handleResponse(const QString &data)
+{
+    const qint64 receivedUs = clockSync.hostNowUs();
+    QString trimmed = data.trimmed();
+    qDebug() << "수신된 메시지:" << trimmed;
+
+    // 시계 동기화 응답은 모터 상태와 무관
+    if (clockSync.processPong(trimmed, receivedUs)) {
+        qDebug() << "시계 동기화: offset(us)=" << clockSync.getOffsetUs()
+                 << "drift(ppm)=" << clockSync.getDriftPpm()
+                 << "RTT(us)=" << clockSync.getRoundTripUs();
+        return;
+    }
+
+    // "TURN:3@123456" 처럼 제어기 타임스탬프가 붙은 경우 분리
+    qint64 ctrlUs = 0;
+    const bool hasTimestamp = ClockSync::splitTimestamp(trimmed, trimmed, ctrlUs);
+    if (hasTimestamp) {
+        ctrlUs = clockSync.unwrapControllerTime(ctrlUs);
+    }
+    const bool timed = hasTimestamp && clockSync.isSynced();
+    const qint64 eventUs = timed ? clockSync.toHostTime(ctrlUs) : receivedUs;
+
+    if (trimmed == "ACK") {
+        if (timed && commandSentUs > 0) {
+            emit commandLatency((eventUs - commandSentUs) / 1000.0);
+        }
+        return;
+    }
+
+    if (timed) {
+        qDebug() << "수신 지연(us):" << receivedUs - eventUs;
+    }
+
+    if (motorControl.processResponse(trimmed, eventUs)) {
+        serial->sendCommand("HI");
+        qDebug() << "전송메세지 : HI";
+        publishTelemetry(telemetry::AxisStatus::Connected);
+
+        clockSync.reset();
+        sendClockSyncPing();
+        syncTimer.start(1000);
+        emit connected();
+    }
+
+    QString statusText = motorControl.getStatusMessage();
+    if (trimmed.startsWith("TURN:")) {
+        jobCheckpoint.update(getCompletedValue());
+        publishTelemetry(telemetry::AxisStatus::Running);
+        publishEvent(telemetry::EventType::Turn, eventUs);
+
+        if (hasTimestamp) {
+            // 회전 주기는 제어기 시계 기준으로 측정 (USB 지연 영향 없음)
+            if (lastTurnCtrlUs > 0) {
+                const qint64 periodUs = clockSync.toHostDuration(ctrlUs - lastTurnCtrlUs);
+                statusText += QString(" (주기 %1 ms)").arg(periodUs / 1000.0, 0, 'f', 1);
+            }
+            lastTurnCtrlUs = ctrlUs;
+        }
+    }
+
+    emit statusUpdated(statusText, motorControl.getProgress());
+
+    if (trimmed == "DONE") {
+        TRACE_INSTANT(TraceTrack::UI, "DONE");
+        jobCheckpoint.clear();
+        publishTelemetry(telemetry::AxisStatus::Done);
+        publishEvent(telemetry::EventType::Done, eventUs);
+        running = false;
+        emit jobDone();
+    } else if (trimmed == "STOPPED") {
+        TRACE_INSTANT(TraceTrack::UI, "STOPPED");
+        jobCheckpoint.clear();
+        publishTelemetry(telemetry::AxisStatus::Stopped);
+        publishEvent(telemetry::EventType::Stopped, eventUs);
+        running = false;
+        emit jobStopped();
+    } else if (trimmed == "ESP32 DISCONNECTED") {
+        syncTimer.stop();
+        publishTelemetry(telemetry::AxisStatus::Disconnected);
+        publishEvent(telemetry::EventType::Disconnected);
+        const bool wasRunning = running;
+        if (running) {
+            // 마지막으로 확인된 진행량을 저장해 두고 재연결 시 재개 제안
+            jobCheckpoint.flush();
+            running = false;
+        }
+        emit disconnected(wasRunning);
+    }
+}
+
+int MotorSession::getCompletedValue() const
+{
+    // 시간 모드는 구동 시작 후 경과 시간(초), 회전수 모드는 TURN 값
+    if (motorControl.getCurrentMode() == MotorMode::TIME) {
+        return static_cast<int>((clockSync.hostNowUs() - jobStartUs) / 1000000);
+    }
+    return motorControl.getCurrentValue();
+}
+
+void MotorSession::publishTelemetry(telemetry::AxisStatus status)
+{
+    if (telemetryWriter) {
+        telemetryWriter->updateAxis(axis, status, motorControl.getCurrentMode(),
+                                    motorControl.getRpm(), motorControl.getTargetValue(),
+                                    motorControl.getCurrentValue(), motorControl.getProgress());
+    }
+}
+
+void MotorSession::publishEvent(telemetry::EventType type, qint64 eventUs)
+{
+    if (!telemetryWriter) {
+        return;
+    }
+    // 제어기 시각을 변환한 호스트 시각을 reader 가 쓰는 epoch 시각으로 옮긴다
+    int64_t timestampUs = 0;
+    if (eventUs >= 0) {
+        timestampUs = telemetry::nowUs() - (clockSync.hostNowUs() - eventUs);
+    }
+    telemetryWriter->publishEvent(axis, type, motorControl.getCurrentValue(), motorControl.getTargetValue(), timestampUs);
+}
+
+void MotorSession::sendClockSyncPing()
+{
+    if (!serial->isOpen()) {
+        syncTimer.stop();
+        return;
+    }
+    // PING 을 모르는 구버전 펌웨어에 알 수 없는 명령을 계속 보내지 않는다
+    if (clockSync.isPongOverdue()) {
+        syncTimer.stop();
+        emit clockSyncFailed();
+        return;
+    }
+    serial->sendCommand(clockSync.buildPing());
+}
@@ -1,70 +1,100 @@
-#include "serialhandler.h"
-#include <QDebug>
-
-SerialHandler::SerialHandler(QObject *parent)
-    : QObject(parent)
-{
-    serial = new QSerialPort(this);
-    connect(serial, &QSerialPort::readyRead, this, &SerialHandler::handleReadyRead);
-    connect(serial, &QSerialPort::errorOccurred, this, &SerialHandler::handleError);
-
-}
-
-SerialHandler::~SerialHandler()
-{
-    if (serial->isOpen())
-        serial->close();
-}
-
-bool SerialHandler::openSerialPort(const QString &portName, qint32 baudRate)
-{
-    if (serial->isOpen()) {
-        serial->close();  // 기존 포트를 먼저 닫음
-    }
-    serial->setPortName(portName);
-    serial->setBaudRate(baudRate);
-    serial->setDataBits(QSerialPort::Data8);
-    serial->setParity(QSerialPort::NoParity);
-    serial->setStopBits(QSerialPort::OneStop);
-    serial->setFlowControl(QSerialPort::NoFlowControl);
-
-    if (serial->open(QIODevice::ReadWrite)) {
-        qDebug() << "Serial opened successfully.";
-        return true;
-    } else {
-        qDebug() << "Failed to open serial port:" << serial->errorString();
-        return false;
-    }
-}
-
-void SerialHandler::sendCommand(const QString &command)
-{
-    if (serial->isOpen()) {
-        serial->write(command.toUtf8());
-    }
-}
-void SerialHandler::sendData(const QString &data)
-{
-    if (serial && serial->isOpen()) {
-        serial->write(data.toUtf8());
-        qDebug() << "Sent to ESP32:" << data;
-    } else {
-        qDebug() << "Serial port not open!";
-    }
-}
-
-void SerialHandler::handleReadyRead()
-{
-    QByteArray data = serial->readAll();
-    QString message = QString::fromUtf8(data).trimmed();
-    emit dataReceived(message);
-}
-
-void SerialHandler::handleError(QSerialPort::SerialPortError error)
-{
-    if (error == QSerialPort::ResourceError) {
-        qDebug() << "Serial port error: Disconnected or unavailable";
-        serial->close();
-        emit dataReceived("ESP32 DISCONNECTED");
-    }
-}
+#include "serialhandler.h"
+#include "tracer.h"
+#include <QDebug>
+
+SerialHandler::SerialHandler(QObject *parent)
+    : QObject(parent)
+{
+    serial = new QSerialPort(this);
+    connect(serial, &QSerialPort::readyRead, this, &SerialHandler::handleReadyRead);
+    connect(serial, &QSerialPort::errorOccurred, this, &SerialHandler::handleError);
+
+}
+
+SerialHandler::~SerialHandler()
+{
+    if (serial->isOpen())
+        serial->close();
+}
+
+bool SerialHandler::openSerialPort(const QString &portName, qint32 baudRate)
+{
+    if (serial->isOpen()) {
+        serial->close();  // 기존 포트를 먼저 닫음
+    }
+    readBuffer.clear();
+    serial->setPortName(portName);
+    serial->setBaudRate(baudRate);
+    serial->setDataBits(QSerialPort::Data8);
+    serial->setParity(QSerialPort::NoParity);
+    serial->setStopBits(QSerialPort::OneStop);
+    serial->setFlowControl(QSerialPort::NoFlowControl);
+
+    if (serial->open(QIODevice::ReadWrite)) {
+        qDebug() << "Serial opened successfully.";
+        return true;
+    } else {
+        qDebug() << "Failed to open serial port:" << serial->errorString();
+        return false;
+    }
+}
+
+bool SerialHandler::isOpen() const
+{
+    return serial->isOpen();
+}
+
+void SerialHandler::sendCommand(const QString &command)
+{
+    TRACE_SCOPE_ARG(TraceTrack::SerialIO, "serial write", command.trimmed());
+    if (serial->isOpen()) {
+        // 모든 명령은 줄바꿈으로 끝난다 (PING 과 다른 명령이 한 번에 전송되어도 구분되도록)
+        QByteArray frame = command.toUtf8();
+        if (!frame.endsWith('\n')) {
+            frame.append('\n');
+        }
+        serial->write(frame);
+    }
+}
+void SerialHandler::sendData(const QString &data)
+{
+    if (serial && serial->isOpen()) {
+        serial->write(data.toUtf8());
+        qDebug() << "Sent to ESP32:" << data;
+    } else {
+        qDebug() << "Serial port not open!";
+    }
+}
+
+void SerialHandler::handleReadyRead()
+{
+    TRACE_SCOPE(TraceTrack::SerialIO, "serial read");
+    readBuffer.append(serial->readAll());
+
+    // readAll() 은 응답 경계와 무관하므로 줄 단위로 잘라서 전달
+    int newline;
+    while ((newline = readBuffer.indexOf('\n')) >= 0) {
+        const QString message = QString::fromUtf8(readBuffer.left(newline)).trimmed();
+        readBuffer.remove(0, newline + 1);
+        if (message.isEmpty()) {
+            continue;
+        }
+        TRACE_INSTANT_ARG(TraceTrack::SerialIO, "rx", message);
+        emit dataReceived(message);
+    }
+
+    if (readBuffer.size() > MaxLineLength) {
+        qDebug() << "줄바꿈 없는 수신 데이터 폐기:" << readBuffer.size() << "bytes";
+        readBuffer.clear();
+    }
+}
+
+void SerialHandler::handleError(QSerialPort::SerialPortError error)
+{
+    if (error == QSerialPort::ResourceError) {
+        qDebug() << "Serial port error: Disconnected or unavailable";
+        serial->close();
+        readBuffer.clear();
+        emit dataReceived("ESP32 DISCONNECTED");
+    }
+}
@@ -0,0 +1,143 @@
+#include "telemetrywriter.h"
+#include <QDebug>
+#include <QtGlobal>
+#include <new>
+
+#ifdef Q_OS_UNIX
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+using namespace telemetry;
+
+TelemetryWriter::TelemetryWriter(const char *name)
+{
+#ifdef Q_OS_UNIX
+    const int fd = shm_open(name, O_CREAT | O_RDWR, 0644);
+    if (fd < 0) {
+        qDebug() << "텔레메트리 공유 메모리 생성 실패:" << name;
+        return;
+    }
+    // 두 번째 인스턴스가 같은 축 레코드에 쓰면 seqlock 이 깨지므로 게시하지 않는다
+    // (flock 을 지원하지 않는 파일시스템이면 잠금 없이 진행)
+    if (flock(fd, LOCK_EX | LOCK_NB) != 0 && errno == EWOULDBLOCK) {
+        qDebug() << "다른 인스턴스가 텔레메트리를 게시 중이므로 게시하지 않습니다:" << name;
+        ::close(fd);
+        return;
+    }
+    if (ftruncate(fd, sizeof(Header)) != 0) {
+        qDebug() << "텔레메트리 공유 메모리 크기 설정 실패:" << name;
+        ::close(fd);
+        return;
+    }
+    void *addr = mmap(nullptr, sizeof(Header), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (addr == MAP_FAILED) {
+        qDebug() << "텔레메트리 공유 메모리 매핑 실패:" << name;
+        ::close(fd);
+        return;
+    }
+    lockFd = fd;
+    shared = static_cast<Header *>(addr);
+
+    // 같은 레이아웃이면 이벤트 번호를 이어서 사용 (붙어 있던 reader 가 그대로 따라올 수 있도록)
+    const bool compatible = shared->magic.load(std::memory_order_acquire) == Magic
+                            && shared->version == Version
+                            && shared->maxAxes == MaxAxes
+                            && shared->eventCapacity == EventCapacity;
+    if (!compatible) {
+        shared = new (addr) Header();
+        shared->version = Version;
+        shared->maxAxes = MaxAxes;
+        shared->eventCapacity = EventCapacity;
+        shared->magic.store(Magic, std::memory_order_release);
+    } else {
+        // 이전 writer 가 기록 도중 종료되었으면 seq 가 홀수로 남아 reader 가 영원히 재시도한다
+        for (AxisRecord &record : shared->axes) {
+            const uint64_t seq = record.seq.load(std::memory_order_relaxed);
+            if (seq & 1) {
+                record.seq.store(seq + 1, std::memory_order_release);
+            }
+        }
+    }
+#else
+    Q_UNUSED(name);
+#endif
+}
+
+TelemetryWriter::~TelemetryWriter()
+{
+#ifdef Q_OS_UNIX
+    if (!shared) {
+        return;
+    }
+    // 프로그램 종료 = 모든 축 연결 해제
+    const uint32_t count = shared->axisCount.load(std::memory_order_relaxed);
+    for (uint32_t i = 0; i < count; ++i) {
+        AxisRecord &record = shared->axes[i];
+        const uint64_t seq = record.seq.load(std::memory_order_relaxed);
+        record.seq.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        record.status.store(static_cast<uint32_t>(AxisStatus::Disconnected), std::memory_order_relaxed);
+        record.updatedUs.store(nowUs(), std::memory_order_relaxed);
+        record.seq.store(seq + 2, std::memory_order_release);
+    }
+    munmap(shared, sizeof(Header));
+    ::close(lockFd);
+#endif
+}
+
+bool TelemetryWriter::isOpen() const
+{
+    return shared != nullptr;
+}
+
+void TelemetryWriter::updateAxis(int axis, AxisStatus status, MotorMode mode,
+                                 int rpm, int target, int progress, int percent)
+{
+    if (!shared || axis < 0 || axis >= static_cast<int>(MaxAxes)) {
+        return;
+    }
+
+    AxisRecord &record = shared->axes[axis];
+    const uint64_t seq = record.seq.load(std::memory_order_relaxed);
+    record.seq.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    record.status.store(static_cast<uint32_t>(status), std::memory_order_relaxed);
+    record.mode.store(mode == MotorMode::TIME ? 1 : 0, std::memory_order_relaxed);
+    record.rpm.store(rpm, std::memory_order_relaxed);
+    record.target.store(target, std::memory_order_relaxed);
+    record.progress.store(progress, std::memory_order_relaxed);
+    record.percent.store(percent, std::memory_order_relaxed);
+    record.updatedUs.store(nowUs(), std::memory_order_relaxed);
+
+    record.seq.store(seq + 2, std::memory_order_release);
+
+    if (shared->axisCount.load(std::memory_order_relaxed) <= static_cast<uint32_t>(axis)) {
+        shared->axisCount.store(axis + 1, std::memory_order_release);
+    }
+}
+
+void TelemetryWriter::publishEvent(int axis, EventType type, int value, int target, int64_t timestampUs)
+{
+    if (!shared) {
+        return;
+    }
+
+    const uint64_t index = shared->writeIndex.load(std::memory_order_relaxed);
+    EventRecord &slot = shared->events[index & (EventCapacity - 1)];
+    slot.seq.store(2 * index + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    slot.timestampUs.store(timestampUs != 0 ? timestampUs : nowUs(), std::memory_order_relaxed);
+    slot.axis.store(static_cast<uint16_t>(axis), std::memory_order_relaxed);
+    slot.type.store(static_cast<uint16_t>(type), std::memory_order_relaxed);
+    slot.value.store(value, std::memory_order_relaxed);
+    slot.target.store(target, std::memory_order_relaxed);
+
+    slot.seq.store(2 * index + 2, std::memory_order_release);
+    shared->writeIndex.store(index + 1, std::memory_order_release);
+}
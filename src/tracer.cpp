@@ -0,0 +1,194 @@
+#include "tracer.h"
+#include <QDebug>
+#include <QFile>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace {
+
+struct TraceEvent {
+    const char *name = nullptr;
+    char phase = 'i';   // 'X' = complete, 'i' = instant
+    TraceTrack track = TraceTrack::UI;
+    qint64 tsUs = 0;
+    qint64 durUs = 0;
+    QString arg;
+};
+
+constexpr size_t ChunkSize = 4096;
+constexpr size_t MaxChunks = 245;
+constexpr size_t MaxEventsPerThread = ChunkSize * MaxChunks;   // 약 100만 개
+
+// 스레드별 버퍼: 소유 스레드만 기록하며 락을 잡지 않는다
+// 이벤트를 슬롯에 쓴 뒤 count 를 release 로 올리므로 writeJson() 은 count 까지 안전하게 읽을 수 있다.
+// 청크는 한 번 할당되면 해제되지 않아 기록 중 재할당으로 읽기 포인터가 무효화되지 않는다.
+struct ThreadBuffer {
+    std::unique_ptr<TraceEvent[]> chunks[MaxChunks];
+    std::atomic<size_t> count{0};
+    std::atomic<quint64> dropped{0};
+    int threadIndex = 0;
+
+    const TraceEvent &at(size_t index) const { return chunks[index / ChunkSize][index % ChunkSize]; }
+};
+
+std::mutex registryMutex;
+std::vector<std::unique_ptr<ThreadBuffer>> registry;
+const auto clockOrigin = std::chrono::steady_clock::now();
+
+ThreadBuffer &localBuffer()
+{
+    thread_local ThreadBuffer *buffer = nullptr;
+    if (!buffer) {
+        std::lock_guard<std::mutex> lock(registryMutex);
+        registry.push_back(std::make_unique<ThreadBuffer>());
+        buffer = registry.back().get();
+        buffer->threadIndex = static_cast<int>(registry.size());
+    }
+    return *buffer;
+}
+
+void record(TraceEvent &&event)
+{
+    ThreadBuffer &buffer = localBuffer();
+    const size_t index = buffer.count.load(std::memory_order_relaxed);
+    if (index >= MaxEventsPerThread) {
+        buffer.dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    std::unique_ptr<TraceEvent[]> &chunk = buffer.chunks[index / ChunkSize];
+    if (!chunk) {
+        chunk.reset(new TraceEvent[ChunkSize]);
+    }
+    chunk[index % ChunkSize] = std::move(event);
+    buffer.count.store(index + 1, std::memory_order_release);
+}
+
+const char *trackName(TraceTrack track)
+{
+    switch (track) {
+    case TraceTrack::SerialIO: return "Serial I/O";
+    case TraceTrack::Parsing:  return "Parsing";
+    case TraceTrack::UI:       return "UI";
+    }
+    return "Unknown";
+}
+
+int trackId(TraceTrack track)
+{
+    return static_cast<int>(track) + 1;
+}
+
+QByteArray jsonEscape(const QString &text)
+{
+    QByteArray out;
+    const QByteArray utf8 = text.toUtf8();
+    out.reserve(utf8.size() + 8);
+    for (char c : utf8) {
+        switch (c) {
+        case '"':  out += "\\\""; break;
+        case '\\': out += "\\\\"; break;
+        case '\n': out += "\\n"; break;
+        case '\r': out += "\\r"; break;
+        case '\t': out += "\\t"; break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                out += QString::asprintf("\\u%04x", c).toUtf8();
+            } else {
+                out += c;
+            }
+        }
+    }
+    return out;
+}
+
+} // namespace
+
+std::atomic<bool> Tracer::enabled{false};
+
+void Tracer::start()
+{
+    {
+        std::lock_guard<std::mutex> lock(registryMutex);
+        for (auto &buffer : registry) {
+            buffer->count.store(0, std::memory_order_relaxed);
+            buffer->dropped.store(0, std::memory_order_relaxed);
+        }
+    }
+    enabled.store(true, std::memory_order_relaxed);
+    qDebug() << "트레이싱 시작";
+}
+
+void Tracer::stop()
+{
+    enabled.store(false, std::memory_order_relaxed);
+}
+
+qint64 Tracer::nowUs()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now() - clockOrigin).count();
+}
+
+void Tracer::complete(TraceTrack track, const char *name, qint64 startUs, qint64 durUs, const QString &arg)
+{
+    record(TraceEvent{name, 'X', track, startUs, durUs, arg});
+}
+
+void Tracer::instant(TraceTrack track, const char *name, const QString &arg)
+{
+    record(TraceEvent{name, 'i', track, nowUs(), 0, arg});
+}
+
+bool Tracer::writeJson(const QString &path)
+{
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        qDebug() << "트레이스 파일 열기 실패:" << path << file.errorString();
+        return false;
+    }
+
+    file.write("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    file.write("{\"ph\":\"M\",\"pid\":1,\"name\":\"process_name\",\"args\":{\"name\":\"stepperESP32\"}}");
+    for (TraceTrack track : {TraceTrack::SerialIO, TraceTrack::Parsing, TraceTrack::UI}) {
+        file.write(QString(",\n{\"ph\":\"M\",\"pid\":1,\"tid\":%1,\"name\":\"thread_name\",\"args\":{\"name\":\"%2\"}}")
+                       .arg(trackId(track)).arg(trackName(track)).toUtf8());
+        file.write(QString(",\n{\"ph\":\"M\",\"pid\":1,\"tid\":%1,\"name\":\"thread_sort_index\",\"args\":{\"sort_index\":%1}}")
+                       .arg(trackId(track)).toUtf8());
+    }
+
+    quint64 total = 0;
+    quint64 dropped = 0;
+    std::lock_guard<std::mutex> lock(registryMutex);
+    for (auto &buffer : registry) {
+        // 기록 중인 스레드가 있어도 count 이전의 이벤트는 다시 쓰이지 않는다
+        const size_t count = buffer->count.load(std::memory_order_acquire);
+        dropped += buffer->dropped.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < count; ++i) {
+            const TraceEvent &e = buffer->at(i);
+            QByteArray line = ",\n{\"ph\":\"";
+            line += e.phase;
+            line += "\",\"pid\":1,\"tid\":" + QByteArray::number(trackId(e.track));
+            line += ",\"ts\":" + QByteArray::number(e.tsUs);
+            if (e.phase == 'X') {
+                line += ",\"dur\":" + QByteArray::number(e.durUs);
+            } else {
+                line += ",\"s\":\"t\"";
+            }
+            line += ",\"name\":\"" + jsonEscape(QString::fromUtf8(e.name)) + "\"";
+            line += ",\"args\":{\"thread\":" + QByteArray::number(buffer->threadIndex);
+            if (!e.arg.isEmpty()) {
+                line += ",\"detail\":\"" + jsonEscape(e.arg) + "\"";
+            }
+            line += "}}";
+            file.write(line);
+            ++total;
+        }
+    }
+    file.write("\n]}\n");
+    file.close();
+
+    qDebug() << "트레이스 저장:" << path << "이벤트" << total << "개, 누락" << dropped << "개";
+    return true;
+}
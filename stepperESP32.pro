@@ -1,29 +1,32 @@
-QT       += core gui serialport
-
-greaterThan(QT_MAJOR_VERSION, 4): QT += widgets
-
-CONFIG += c++17
-
-# You can make your code fail to compile if it uses deprecated APIs.
-# In order to do so, uncomment the following line.
-#DEFINES += QT_DISABLE_DEPRECATED_BEFORE=0x060000    # disables all the APIs deprecated before Qt 6.0.0
-INCLUDEPATH += $$PWD/inc
-
-SOURCES += \
-    main.cpp \
-    $$files($$PWD/src/*.cpp)\
-
-HEADERS += \
-    $$files($$PWD/inc/*.h)\
-
-FORMS += \
-    mainwindow.ui
-
-# Default rules for deployment.
-qnx: target.path = /tmp/$${TARGET}/bin
-else: unix:!android: target.path = /opt/$${TARGET}/bin
-!isEmpty(target.path): INSTALLS += target
-
-
-RESOURCES += \
-    images.qrc
+QT       += core gui serialport
+
+greaterThan(QT_MAJOR_VERSION, 4): QT += widgets
+
+CONFIG += c++2a    # C++20 (AsyncMotor 코루틴)
+
+# You can make your code fail to compile if it uses deprecated APIs.
+# In order to do so, uncomment the following line.
+#DEFINES += QT_DISABLE_DEPRECATED_BEFORE=0x060000    # disables all the APIs deprecated before Qt 6.0.0
+INCLUDEPATH += $$PWD/inc
+
+# 텔레메트리 공유 메모리 (shm_open)
+linux: LIBS += -lrt
+
+SOURCES += \
+    main.cpp \
+    $$files($$PWD/src/*.cpp)\
+
+HEADERS += \
+    $$files($$PWD/inc/*.h)\
+
+FORMS += \
+    mainwindow.ui
+
+# Default rules for deployment.
+qnx: target.path = /tmp/$${TARGET}/bin
+else: unix:!android: target.path = /opt/$${TARGET}/bin
+!isEmpty(target.path): INSTALLS += target
+
+
+RESOURCES += \
+    images.qrc
@@ -0,0 +1,35 @@
+QT       += core serialport testlib
+QT       -= gui
+
+CONFIG += c++2a console testcase    # make check 로 실행
+CONFIG -= app_bundle
+
+TARGET = tst_asyncmotor
+
+!linux: error("tst_asyncmotor 는 Linux pty 가 필요합니다")
+
+INCLUDEPATH += $$PWD/../../inc $$PWD/../../tools/loadtest
+
+SOURCES += \
+    tst_asyncmotor.cpp \
+    $$PWD/../../tools/loadtest/virtualmotor.cpp \
+    $$PWD/../../src/asyncmotor.cpp \
+    $$PWD/../../src/serialhandler.cpp \
+    $$PWD/../../src/motorcontrol.cpp \
+    $$PWD/../../src/motorcommandfactory.cpp \
+    $$PWD/../../src/rotationcommand.cpp \
+    $$PWD/../../src/timecommand.cpp \
+    $$PWD/../../src/clocksync.cpp \
+    $$PWD/../../src/tracer.cpp
+
+HEADERS += \
+    $$PWD/../../tools/loadtest/virtualmotor.h \
+    $$PWD/../../inc/asyncmotor.h \
+    $$PWD/../../inc/motortask.h \
+    $$PWD/../../inc/serialhandler.h \
+    $$PWD/../../inc/motorcontrol.h \
+    $$PWD/../../inc/motorcommandfactory.h \
+    $$PWD/../../inc/rotationcommand.h \
+    $$PWD/../../inc/timecommand.h \
+    $$PWD/../../inc/clocksync.h \
+    $$PWD/../../inc/tracer.h
@@ -0,0 +1,173 @@
+#include <QSignalSpy>
+#include <QtTest>
+#include <memory>
+#include "asyncmotor.h"
+#include "virtualmotor.h"
+
+// 가상 제어기(pty)를 상대로 AsyncMotor 코루틴 시퀀스를 실행
+namespace {
+
+constexpr int TurnPeriodMs = 20;
+constexpr int WaitMs = 5000;
+
+MotorTask connectAndMove(AsyncMotor &motor, QString port, int rotations)
+{
+    if (co_await motor.connect(port) != MotorResult::Ok) {
+        co_return MotorResult::Failed;
+    }
+    co_return co_await motor.move(60, rotations, WaitMs);
+}
+
+MotorTask moveTask(AsyncMotor &motor, int rotations, int timeoutMs)
+{
+    co_return co_await motor.move(60, rotations, timeoutMs);
+}
+
+MotorTask progressTask(AsyncMotor &motor, int value, int &reached)
+{
+    const MotorResult result = co_await motor.waitProgress(value, WaitMs);
+    reached = motor.control().getCurrentValue();
+    co_return result;
+}
+
+MotorTask timeoutThenRetry(AsyncMotor &motor, MotorResult &first)
+{
+    first = co_await motor.move(60, 1000, 5 * TurnPeriodMs);
+    // Timeout 뒤에도 제어기는 돌고 있으므로 정지 후 다시 명령
+    motor.stop();
+    co_await motor.sleep(5 * TurnPeriodMs);
+    co_return co_await motor.move(60, 2, WaitMs);
+}
+
+} // namespace
+
+class TestAsyncMotor : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void init();
+    void cleanup();
+
+    void moveCompletes();
+    void waitProgressWakesBeforeDone();
+    void waitProgressFailsWithoutJob();
+    void timeoutReleasesMotor();
+    void stopResumesWithStopped();
+
+private:
+    bool connectMotor();
+
+    std::unique_ptr<VirtualMotor> controller;
+    std::unique_ptr<SerialHandler> serial;
+    std::unique_ptr<AsyncMotor> motor;
+};
+
+void TestAsyncMotor::init()
+{
+    controller = std::make_unique<VirtualMotor>();
+    QVERIFY(controller->open());
+    controller->startResponder(TurnPeriodMs);
+    serial = std::make_unique<SerialHandler>();
+    motor = std::make_unique<AsyncMotor>(serial.get());
+}
+
+void TestAsyncMotor::cleanup()
+{
+    motor.reset();
+    serial.reset();
+    controller->stop();
+    const quint64 unknown = controller->unknownCommands();
+    controller.reset();
+
+    // 모든 명령이 한 줄에 하나씩 도착해야 한다 (예: "HI" 와 "RPM:..." 이 붙어 오면 실패)
+    QCOMPARE(unknown, quint64(0));
+}
+
+bool TestAsyncMotor::connectMotor()
+{
+    MotorTask task = [](AsyncMotor &m, QString port) -> MotorTask {
+        co_return co_await m.connect(port);
+    }(*motor, controller->slavePath());
+    return QTest::qWaitFor([&]() { return task.isDone(); }, WaitMs) && task.result() == MotorResult::Ok;
+}
+
+void TestAsyncMotor::moveCompletes()
+{
+    MotorTask task = connectAndMove(*motor, controller->slavePath(), 3);
+    QVERIFY(QTest::qWaitFor([&]() { return task.isDone(); }, WaitMs));
+    QVERIFY(task.result() == MotorResult::Ok);
+
+    // "TURN:3@<µs>" 의 타임스탬프가 떼어져 진행 값이 반영되어야 한다
+    QCOMPARE(motor->control().getCurrentValue(), 3);
+    QCOMPARE(motor->control().getProgress(), 100);
+}
+
+void TestAsyncMotor::waitProgressWakesBeforeDone()
+{
+    QVERIFY(connectMotor());
+
+    MotorTask job = moveTask(*motor, 10, WaitMs);
+    int reached = 0;
+    MotorTask watcher = progressTask(*motor, 3, reached);
+
+    QVERIFY(QTest::qWaitFor([&]() { return watcher.isDone(); }, WaitMs));
+    QVERIFY(watcher.result() == MotorResult::Ok);
+    QVERIFY(reached >= 3);
+    QVERIFY(!job.isDone());
+
+    QVERIFY(QTest::qWaitFor([&]() { return job.isDone(); }, WaitMs));
+    QVERIFY(job.result() == MotorResult::Ok);
+    QCOMPARE(motor->control().getCurrentValue(), 10);
+}
+
+void TestAsyncMotor::waitProgressFailsWithoutJob()
+{
+    MotorTask done = connectAndMove(*motor, controller->slavePath(), 3);
+    QVERIFY(QTest::qWaitFor([&]() { return done.isDone(); }, WaitMs));
+    QVERIFY(done.result() == MotorResult::Ok);
+
+    // 끝난 작업의 진행 값(3)이 남아 있어도 새 작업이 없으면 기다릴 대상이 없다
+    int reached = 0;
+    MotorTask watcher = progressTask(*motor, 2, reached);
+    QVERIFY(watcher.isDone());
+    QVERIFY(watcher.result() == MotorResult::Failed);
+}
+
+void TestAsyncMotor::timeoutReleasesMotor()
+{
+    QVERIFY(connectMotor());
+
+    MotorResult first = MotorResult::Ok;
+    MotorTask task = timeoutThenRetry(*motor, first);
+    QVERIFY(QTest::qWaitFor([&]() { return task.isDone(); }, WaitMs));
+    QVERIFY(first == MotorResult::Timeout);
+    QVERIFY(task.result() == MotorResult::Ok);
+    QCOMPARE(motor->control().getCurrentValue(), 2);
+}
+
+void TestAsyncMotor::stopResumesWithStopped()
+{
+    QVERIFY(connectMotor());
+    QSignalSpy responses(motor.get(), &AsyncMotor::responseReceived);
+
+    MotorTask job = moveTask(*motor, 1000, WaitMs);
+    QVERIFY(QTest::qWaitFor([&]() { return motor->control().getCurrentValue() >= 2; }, WaitMs));
+    motor->stop();
+
+    QVERIFY(job.isDone());
+    QVERIFY(job.result() == MotorResult::Stopped);
+
+    // 제어기도 STOP 을 받아 STOPPED 로 응답
+    QVERIFY(QTest::qWaitFor([&]() {
+        for (const QList<QVariant> &args : responses) {
+            if (args.at(0).toString() == "STOPPED") {
+                return true;
+            }
+        }
+        return false;
+    }, WaitMs));
+}
+
+QTEST_GUILESS_MAIN(TestAsyncMotor)
+#include "tst_asyncmotor.moc"
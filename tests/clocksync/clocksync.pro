@@ -0,0 +1,16 @@
+QT       += core testlib
+QT       -= gui
+
+CONFIG += c++2a console testcase    # make check 로 실행
+CONFIG -= app_bundle
+
+TARGET = tst_clocksync
+
+INCLUDEPATH += $$PWD/../../inc
+
+SOURCES += \
+    tst_clocksync.cpp \
+    $$PWD/../../src/clocksync.cpp
+
+HEADERS += \
+    $$PWD/../../inc/clocksync.h
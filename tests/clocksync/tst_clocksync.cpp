@@ -0,0 +1,151 @@
+#include <QtTest>
+#include "clocksync.h"
+
+// 가상 제어기 시계로 만든 PING/PONG 교환으로 오프셋, 드리프트, 시각 변환을 검증
+namespace {
+
+constexpr qint64 Wrap32 = qint64(1) << 32;
+constexpr qint64 OneWayUs = 300;     // 편도 지연
+constexpr qint64 ServiceUs = 40;     // 제어기 처리 시간 (t3 - t2)
+
+struct VirtualClock {
+    qint64 offsetUs = 0;
+    double driftPpm = 0.0;
+    bool micros32 = false;           // ESP32 micros() 처럼 32비트에서 wrap
+
+    qint64 ctrlAt(qint64 hostUs) const
+    {
+        const qint64 ctrl = hostUs + offsetUs + static_cast<qint64>(hostUs * driftPpm * 1e-6);
+        return micros32 ? ctrl % Wrap32 : ctrl;
+    }
+};
+
+// t1 에 PING 을 보내고 t4 에 받은 PONG 을 처리
+bool exchange(ClockSync &sync, const VirtualClock &controller, qint64 t1)
+{
+    const qint64 t2 = controller.ctrlAt(t1 + OneWayUs);
+    const qint64 t3 = controller.ctrlAt(t1 + OneWayUs + ServiceUs);
+    const qint64 t4 = t1 + 2 * OneWayUs + ServiceUs;
+    return sync.processPong(QString("PONG:%1:%2:%3").arg(t1).arg(t2).arg(t3), t4);
+}
+
+} // namespace
+
+class TestClockSync : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void splitsTimestamp();
+    void estimatesOffset();
+    void fitsDrift();
+    void unwrapsMicros32();
+    void rejectsMalformedPong();
+    void givesUpWithoutPong();
+};
+
+void TestClockSync::splitsTimestamp()
+{
+    QString body;
+    qint64 ctrlUs = 0;
+    QVERIFY(ClockSync::splitTimestamp("TURN:3@123456", body, ctrlUs));
+    QCOMPARE(body, QString("TURN:3"));
+    QCOMPARE(ctrlUs, qint64(123456));
+
+    QVERIFY(!ClockSync::splitTimestamp("DONE", body, ctrlUs));
+    QCOMPARE(body, QString("DONE"));
+    QVERIFY(!ClockSync::splitTimestamp("TURN:3@abc", body, ctrlUs));
+}
+
+void TestClockSync::estimatesOffset()
+{
+    ClockSync sync;
+    VirtualClock controller;
+    controller.offsetUs = 7500000;
+
+    QVERIFY(!sync.isSynced());
+    QVERIFY(exchange(sync, controller, 1000000));
+    QVERIFY(sync.isSynced());
+
+    QVERIFY(qAbs(sync.getOffsetUs() - controller.offsetUs) < 1.0);
+    QCOMPARE(sync.getRoundTripUs(), 2 * OneWayUs);
+
+    const qint64 hostUs = 1500000;
+    QVERIFY(qAbs(sync.toHostTime(controller.ctrlAt(hostUs)) - hostUs) <= 1);
+}
+
+void TestClockSync::fitsDrift()
+{
+    ClockSync sync;
+    VirtualClock controller;
+    controller.offsetUs = -250000;
+    controller.driftPpm = 80.0;
+
+    for (int i = 0; i < 30; ++i) {
+        QVERIFY(exchange(sync, controller, 1000000 + i * 1000000LL));
+    }
+
+    QVERIFY(qAbs(sync.getDriftPpm() - controller.driftPpm) < 0.5);
+
+    // 마지막 샘플 1분 뒤의 제어기 시각도 수 µs 이내로 변환
+    const qint64 hostUs = 90000000;
+    QVERIFY(qAbs(sync.toHostTime(controller.ctrlAt(hostUs)) - hostUs) <= 5);
+    QVERIFY(qAbs(sync.toHostDuration(1000080) - 1000000) <= 1);
+}
+
+void TestClockSync::unwrapsMicros32()
+{
+    ClockSync sync;
+    VirtualClock controller;
+    controller.micros32 = true;
+    controller.offsetUs = Wrap32 - 10000000;    // 시작 10초 뒤 제어기 시계가 0 으로 돌아감
+
+    for (int i = 0; i < 20; ++i) {
+        QVERIFY(exchange(sync, controller, 1000000 + i * 1000000LL));
+    }
+    QVERIFY(qAbs(sync.getOffsetUs() - controller.offsetUs) < 1.0);
+    QVERIFY(qAbs(sync.getDriftPpm()) < 0.1);
+
+    // wrap 직전/직후의 TURN 타임스탬프: 주기가 음수가 되지 않아야 한다
+    const qint64 before = sync.unwrapControllerTime(controller.ctrlAt(20500000));
+    const qint64 after = sync.unwrapControllerTime(controller.ctrlAt(21500000));
+    QCOMPARE(after - before, qint64(1000000));
+    QVERIFY(qAbs(sync.toHostTime(after) - 21500000) <= 1);
+
+    // 64비트 타임스탬프는 그대로 유지
+    ClockSync wide;
+    QCOMPARE(wide.unwrapControllerTime(5 * Wrap32 + 10), 5 * Wrap32 + 10);
+    QCOMPARE(wide.unwrapControllerTime(5 * Wrap32 + 1000), 5 * Wrap32 + 1000);
+}
+
+void TestClockSync::rejectsMalformedPong()
+{
+    ClockSync sync;
+    QVERIFY(!sync.processPong("TURN:1", 100));
+    QVERIFY(sync.processPong("PONG:1:2", 100));
+    QVERIFY(sync.processPong("PONG:200:300:250", 400));   // t3 < t2
+    QVERIFY(sync.processPong("PONG:500:300:350", 400));   // t4 < t1
+    QVERIFY(!sync.isSynced());
+}
+
+void TestClockSync::givesUpWithoutPong()
+{
+    ClockSync sync;
+    VirtualClock controller;
+    for (int i = 0; i < ClockSync::MaxUnansweredPings - 1; ++i) {
+        sync.buildPing();
+    }
+    QVERIFY(!sync.isPongOverdue());
+    sync.buildPing();
+    QVERIFY(sync.isPongOverdue());
+
+    // 응답이 오면 다시 카운트
+    QVERIFY(exchange(sync, controller, 1000000));
+    QVERIFY(!sync.isPongOverdue());
+
+    sync.reset();
+    QVERIFY(!sync.isPongOverdue());
+}
+
+QTEST_GUILESS_MAIN(TestClockSync)
+#include "tst_clocksync.moc"
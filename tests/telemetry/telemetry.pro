@@ -0,0 +1,23 @@
+QT       += core testlib
+QT       -= gui
+
+CONFIG += c++2a console testcase    # make check 로 실행
+CONFIG -= app_bundle
+
+TARGET = tst_telemetry
+
+!unix: error("tst_telemetry 는 POSIX 공유 메모리가 필요합니다")
+
+INCLUDEPATH += $$PWD/../../inc $$PWD/../../tools/telemetry/reader
+
+SOURCES += \
+    tst_telemetry.cpp \
+    $$PWD/../../src/telemetrywriter.cpp \
+    $$PWD/../../tools/telemetry/reader/telemetryreader.cpp
+
+HEADERS += \
+    $$PWD/../../inc/telemetrywriter.h \
+    $$PWD/../../inc/telemetrylayout.h \
+    $$PWD/../../tools/telemetry/reader/telemetryreader.h
+
+linux: LIBS += -lrt
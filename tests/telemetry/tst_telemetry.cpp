@@ -0,0 +1,141 @@
+#include <QtTest>
+#include <atomic>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <thread>
+#include <unistd.h>
+#include "telemetryreader.h"
+#include "telemetrywriter.h"
+
+// 공유 메모리 텔레메트리의 writer / reader 동작 검증 (GUI 와 겹치지 않는 이름 사용)
+namespace {
+
+constexpr const char *ShmName = "/stepper_telemetry_test";
+
+} // namespace
+
+class TestTelemetry : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void init();
+    void cleanup();
+
+    void eventCarriesTimestamp();
+    void readerSeesConsistentRecords();
+    void secondWriterIsRefused();
+    void reattachRecoversInterruptedWrite();
+};
+
+void TestTelemetry::init()
+{
+    shm_unlink(ShmName);
+}
+
+void TestTelemetry::cleanup()
+{
+    shm_unlink(ShmName);
+}
+
+void TestTelemetry::eventCarriesTimestamp()
+{
+    TelemetryWriter writer(ShmName);
+    QVERIFY(writer.isOpen());
+    TelemetryReader reader;
+    QVERIFY(reader.open(ShmName));
+
+    // 명시한 발생 시각은 그대로, 0 이면 게시 시각
+    const int64_t before = telemetry::nowUs();
+    writer.publishEvent(0, telemetry::EventType::Turn, 1, 10, 123456789);
+    writer.publishEvent(0, telemetry::EventType::Turn, 2, 10);
+
+    std::vector<telemetry::EventSnapshot> events;
+    reader.poll([&](const telemetry::EventSnapshot &event) { events.push_back(event); });
+    QCOMPARE(events.size(), size_t(2));
+    QCOMPARE(events[0].timestampUs, int64_t(123456789));
+    QVERIFY(events[1].timestampUs >= before);
+}
+
+void TestTelemetry::readerSeesConsistentRecords()
+{
+    // writer 가 게시하는 동안 다른 스레드의 reader 가 찢어진 레코드를 보면 안 된다
+    constexpr int Count = 200000;
+    TelemetryWriter writer(ShmName);
+    QVERIFY(writer.isOpen());
+    TelemetryReader reader;
+    QVERIFY(reader.open(ShmName));
+    reader.seekToLatest();
+
+    std::atomic<bool> stop{false};
+    quint64 received = 0;
+    quint64 torn = 0;
+    std::thread readerThread([&]() {
+        int64_t lastIndex = -1;
+        auto check = [&](const telemetry::EventSnapshot &event) {
+            if (static_cast<int64_t>(event.index) <= lastIndex || event.target != event.value * 2) {
+                ++torn;
+            }
+            lastIndex = static_cast<int64_t>(event.index);
+            ++received;
+        };
+        while (!stop.load()) {
+            reader.poll(check);
+            telemetry::AxisSnapshot axis;
+            if (reader.readAxis(0, axis) && axis.target != axis.progress * 2) {
+                ++torn;
+            }
+        }
+        reader.poll(check);
+    });
+
+    for (int i = 0; i < Count; ++i) {
+        writer.publishEvent(0, telemetry::EventType::Turn, i, 2 * i);
+        writer.updateAxis(0, telemetry::AxisStatus::Running, MotorMode::ROTATION, 60, 2 * i, i, 0);
+    }
+    stop = true;
+    readerThread.join();
+
+    QCOMPARE(torn, quint64(0));
+    QCOMPARE(received + reader.lostEvents(), quint64(Count));
+}
+
+void TestTelemetry::secondWriterIsRefused()
+{
+    TelemetryWriter first(ShmName);
+    TelemetryWriter second(ShmName);
+    QVERIFY(first.isOpen());
+    QVERIFY(!second.isOpen());
+}
+
+void TestTelemetry::reattachRecoversInterruptedWrite()
+{
+    {
+        TelemetryWriter writer(ShmName);
+        QVERIFY(writer.isOpen());
+        writer.updateAxis(0, telemetry::AxisStatus::Running, MotorMode::ROTATION, 60, 10, 3, 30);
+    }
+
+    // 기록 도중 종료된 writer 흉내: 축 seq 를 홀수로 남긴다
+    const int fd = shm_open(ShmName, O_RDWR, 0);
+    QVERIFY(fd >= 0);
+    void *addr = mmap(nullptr, sizeof(telemetry::Header), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    QVERIFY(addr != MAP_FAILED);
+    static_cast<telemetry::Header *>(addr)->axes[0].seq.fetch_add(1);
+    munmap(addr, sizeof(telemetry::Header));
+
+    TelemetryReader reader;
+    QVERIFY(reader.open(ShmName));
+    telemetry::AxisSnapshot axis;
+    QVERIFY(!reader.readAxis(0, axis));   // 재시도 한도 후 포기
+
+    // 새 writer 가 붙으면 seq 를 짝수로 돌려 마지막 값을 다시 읽을 수 있다
+    TelemetryWriter writer(ShmName);
+    QVERIFY(writer.isOpen());
+    QVERIFY(reader.readAxis(0, axis));
+    QCOMPARE(axis.progress, 3);
+}
+
+QTEST_GUILESS_MAIN(TestTelemetry)
+#include "tst_telemetry.moc"
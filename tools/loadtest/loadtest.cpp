@@ -0,0 +1,240 @@
+#include "loadtest.h"
+#include "clocksync.h"
+#include <QAbstractEventDispatcher>
+#include <QDebug>
+#include <QPlainTextEdit>
+#include <QProgressBar>
+#include <QTextStream>
+#include <algorithm>
+#include <climits>
+#include <sys/resource.h>
+
+namespace {
+
+// 이 함수를 호출한 스레드(GUI 스레드)의 CPU 시간. 가상 제어기 스레드는 제외된다
+qint64 cpuTimeUs()
+{
+    rusage usage;
+    getrusage(RUSAGE_THREAD, &usage);
+    return (static_cast<qint64>(usage.ru_utime.tv_sec) + usage.ru_stime.tv_sec) * 1000000
+           + usage.ru_utime.tv_usec + usage.ru_stime.tv_usec;
+}
+
+double percentileMs(std::vector<qint64> &values, double p)
+{
+    if (values.empty()) {
+        return 0.0;
+    }
+    const size_t index = std::min(values.size() - 1, static_cast<size_t>(p * values.size()));
+    std::nth_element(values.begin(), values.begin() + index, values.end());
+    return values[index] / 1000.0;
+}
+
+QTextStream &out()
+{
+    static QTextStream stream(stdout);
+    return stream;
+}
+
+} // namespace
+
+LoadTest::LoadTest(const LoadTestConfig &config, QObject *parent)
+    : QObject(parent)
+    , config(config)
+{
+    connect(&probeTimer, &QTimer::timeout, this, &LoadTest::probeEventLoop);
+    loopClock.start();
+}
+
+LoadTest::~LoadTest()
+{
+    teardown();
+}
+
+void LoadTest::start()
+{
+    out() << QString::asprintf("가상 제어기 부하 테스트: 축당 %.1f Hz, 단계당 %d초, 한계 p99 %.1f ms / 손실 %.2f%%\n",
+                               config.rateHz, config.stepSeconds, config.latencyLimitMs, config.lossLimitPercent);
+    out() << "gui% = 메인 이벤트 루프가 깨어 있던 시간 비율 (awake ~ aboutToBlock, 타이머 처리 포함)\n";
+    out() << "cpu% = GUI 스레드 CPU 시간 비율 (가상 제어기 스레드 제외)\n";
+    if (config.widgets) {
+        out() << "--widgets: 위젯 상태 갱신까지 포함하지만 창을 띄우지 않으므로 그리기 비용은 측정되지 않음\n";
+    }
+    out() << "axes  frames/s  loss%   malformed  p50(ms)  p99(ms)  max(ms)  gui%   cpu%   lag avg/max(ms)\n";
+    out().flush();
+
+    // 프레임 처리뿐 아니라 이벤트 루프 한 바퀴 전체(소켓 알림, 시그널 전달 포함)를 측정
+    QAbstractEventDispatcher *dispatcher = QAbstractEventDispatcher::instance();
+    connect(dispatcher, &QAbstractEventDispatcher::awake, this, &LoadTest::eventLoopAwake);
+    connect(dispatcher, &QAbstractEventDispatcher::aboutToBlock, this, &LoadTest::eventLoopAboutToBlock);
+    startStep();
+}
+
+void LoadTest::startStep()
+{
+    axisCount = (axisCount == 0) ? config.startAxes : qMin(axisCount * 2, config.maxAxes);
+
+    for (int i = 0; i < axisCount; ++i) {
+        auto axis = std::make_unique<Axis>();
+        if (!axis->motor.open()) {
+            emit finished();
+            return;
+        }
+
+        axis->serial = std::make_unique<SerialHandler>();
+        if (!axis->serial->openSerialPort(axis->motor.slavePath())) {
+            qDebug() << "가상 포트 열기 실패:" << axis->motor.slavePath();
+            emit finished();
+            return;
+        }
+        // 텔레메트리 축 슬롯은 8개뿐이므로 나머지 축은 슬롯을 나눠 쓴다 (기록 비용은 같음)
+        axis->session = std::make_unique<MotorSession>(
+            axis->serial.get(), &telemetryWriter, i % static_cast<int>(telemetry::MaxAxes),
+            checkpointDir.filePath(QString("axis%1.json").arg(i)));
+        // 가상 제어기는 명령을 읽지 않으므로 전송된 명령은 pty 버퍼에 남는다
+        axis->session->startJob(static_cast<int>(config.rateHz), INT_MAX);
+
+        Axis *raw = axis.get();
+        if (config.widgets) {
+            axis->logView = new QPlainTextEdit;
+            axis->logView->setMaximumBlockCount(1000);
+            axis->progressBar = new QProgressBar;
+            connect(axis->session.get(), &MotorSession::statusUpdated, this,
+                    [raw](const QString &statusText, int progress) {
+                raw->progressBar->setValue(progress);
+                raw->logView->appendPlainText(statusText);
+            });
+        }
+
+        // MotorSession 이 먼저 연결되어 있으므로 이 슬롯은 프레임 처리가 끝난 뒤 호출된다
+        connect(axis->serial.get(), &SerialHandler::dataReceived, this, [this, raw](const QString &line) {
+            handleFrame(*raw, line);
+        });
+        axes.push_back(std::move(axis));
+    }
+
+    latencies.clear();
+    latencies.reserve(static_cast<size_t>(axisCount * config.rateHz * config.stepSeconds * 1.1));
+    busyNs = 0;
+    awakeSinceNs = loopClock.nsecsElapsed();
+    maxLagUs = 0;
+    totalLagUs = 0;
+    probeCount = 0;
+
+    stepStartUs = monotonicUs();
+    cpuStartUs = cpuTimeUs();
+    lastProbeUs = stepStartUs;
+    probeTimer.start(10);
+
+    for (auto &axis : axes) {
+        axis->motor.start(config.rateHz);
+    }
+    QTimer::singleShot(config.stepSeconds * 1000, this, &LoadTest::finishStep);
+}
+
+void LoadTest::finishStep()
+{
+    for (auto &axis : axes) {
+        axis->motor.stop();
+    }
+    stepEndUs = monotonicUs();
+
+    // 큐에 남은 프레임을 처리할 시간
+    QTimer::singleShot(200, this, &LoadTest::reportStep);
+}
+
+void LoadTest::reportStep()
+{
+    probeTimer.stop();
+    const qint64 wallUs = qMax<qint64>(1, monotonicUs() - stepStartUs);
+    const qint64 cpuUs = cpuTimeUs() - cpuStartUs;
+
+    quint64 attempted = 0, received = 0, malformed = 0;
+    for (const auto &axis : axes) {
+        attempted += axis->motor.framesAttempted();
+        received += axis->received;
+        malformed += axis->malformed;
+    }
+
+    const double lossPercent = attempted ? 100.0 * (attempted - qMin(received, attempted)) / attempted : 0.0;
+    const double p50 = percentileMs(latencies, 0.50);
+    const double p99 = percentileMs(latencies, 0.99);
+    const double maxMs = latencies.empty() ? 0.0 : *std::max_element(latencies.begin(), latencies.end()) / 1000.0;
+    const double guiPercent = 100.0 * (busyNs / 1000.0) / wallUs;
+    const double cpuPercent = 100.0 * cpuUs / wallUs;
+    const double lagAvgMs = probeCount ? totalLagUs / 1000.0 / probeCount : 0.0;
+    const double framesPerSec = received * 1e6 / qMax<qint64>(1, stepEndUs - stepStartUs);
+
+    out() << QString::asprintf("%4d  %8.0f  %6.2f  %9llu  %7.2f  %7.2f  %7.2f  %5.1f  %5.1f  %6.2f/%-6.2f\n",
+                               axisCount, framesPerSec, lossPercent, static_cast<unsigned long long>(malformed),
+                               p50, p99, maxMs, guiPercent, cpuPercent, lagAvgMs, maxLagUs / 1000.0);
+    out().flush();
+
+    teardown();
+
+    const bool saturated = p99 > config.latencyLimitMs || lossPercent > config.lossLimitPercent;
+    if (saturated) {
+        out() << QString::asprintf("포화: %d축 (축당 %.1f Hz)에서 한계 초과\n", axisCount, config.rateHz);
+    } else if (axisCount >= config.maxAxes) {
+        out() << QString::asprintf("최대 %d축까지 한계 이내\n", axisCount);
+    } else {
+        startStep();
+        return;
+    }
+    out().flush();
+    emit finished();
+}
+
+void LoadTest::teardown()
+{
+    for (auto &axis : axes) {
+        axis->motor.stop();
+        delete axis->logView;
+        delete axis->progressBar;
+    }
+    axes.clear();
+}
+
+void LoadTest::handleFrame(Axis &axis, const QString &line)
+{
+    // MotorSession::handleResponse 처리가 끝난 시각 = 종단 지연의 끝
+    const qint64 handledUs = monotonicUs();
+
+    // SerialHandler 가 축별 버퍼로 줄 단위 프레임을 맞춰 주므로 readAll() 경계에서 잘린 프레임은 없다
+    QString body;
+    qint64 sentUs = 0;
+    if (!ClockSync::splitTimestamp(line, body, sentUs) || !body.startsWith("TURN:")
+        || sentUs < stepStartUs || sentUs > handledUs) {
+        ++axis.malformed;
+        return;
+    }
+
+    ++axis.received;
+    latencies.push_back(handledUs - sentUs);
+}
+
+void LoadTest::eventLoopAwake()
+{
+    if (awakeSinceNs < 0) {
+        awakeSinceNs = loopClock.nsecsElapsed();
+    }
+}
+
+void LoadTest::eventLoopAboutToBlock()
+{
+    if (awakeSinceNs >= 0) {
+        busyNs += loopClock.nsecsElapsed() - awakeSinceNs;
+        awakeSinceNs = -1;
+    }
+}
+
+void LoadTest::probeEventLoop()
+{
+    // 10ms 타이머가 늦게 도착한 만큼이 이벤트 루프 대기 지연
+    const qint64 now = monotonicUs();
+    const qint64 lag = qMax<qint64>(0, now - lastProbeUs - 10000);
+    lastProbeUs = now;
+    maxLagUs = qMax(maxLagUs, lag);
+    totalLagUs += lag;
+    ++probeCount;
+}
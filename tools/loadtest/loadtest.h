@@ -0,0 +1,84 @@
+#ifndef LOADTEST_H
+#define LOADTEST_H
+
+#include <QElapsedTimer>
+#include <QObject>
+#include <QTemporaryDir>
+#include <QTimer>
+#include <memory>
+#include <vector>
+#include "motorsession.h"
+#include "serialhandler.h"
+#include "telemetrywriter.h"
+#include "virtualmotor.h"
+
+class QPlainTextEdit;
+class QProgressBar;
+
+struct LoadTestConfig {
+    int startAxes = 1;
+    int maxAxes = 64;
+    double rateHz = 50.0;          // 축당 TURN 프레임 주기
+    int stepSeconds = 5;
+    double latencyLimitMs = 50.0;  // p99 종단 지연 한계
+    double lossLimitPercent = 1.0; // 프레임 손실 한계
+    bool widgets = false;          // MainWindow 처럼 로그/진행률 위젯까지 갱신
+};
+
+// 가상 제어기 수를 두 배씩 늘리며 MainWindow 와 같은 MotorSession 수신 경로의 포화 지점을 찾는다
+class LoadTest : public QObject
+{
+    Q_OBJECT
+public:
+    explicit LoadTest(const LoadTestConfig &config, QObject *parent = nullptr);
+    ~LoadTest();
+
+    void start();
+
+signals:
+    void finished();
+
+private slots:
+    void probeEventLoop();
+    void eventLoopAwake();
+    void eventLoopAboutToBlock();
+
+private:
+    struct Axis {
+        VirtualMotor motor;
+        std::unique_ptr<SerialHandler> serial;
+        std::unique_ptr<MotorSession> session;
+        QPlainTextEdit *logView = nullptr;
+        QProgressBar *progressBar = nullptr;
+        quint64 received = 0;
+        quint64 malformed = 0;     // 형식이 맞지 않거나 범위를 벗어난 프레임
+    };
+
+    void startStep();
+    void finishStep();
+    void reportStep();
+    void teardown();
+    void handleFrame(Axis &axis, const QString &line);
+
+    LoadTestConfig config;
+    TelemetryWriter telemetryWriter{"/stepper_loadtest"};   // GUI 의 공유 메모리와 분리
+    QTemporaryDir checkpointDir;
+    std::vector<std::unique_ptr<Axis>> axes;
+    int axisCount = 0;
+
+    QTimer probeTimer;
+    qint64 lastProbeUs = 0;
+    qint64 maxLagUs = 0;
+    qint64 totalLagUs = 0;
+    quint64 probeCount = 0;
+
+    std::vector<qint64> latencies;
+    QElapsedTimer loopClock;
+    qint64 awakeSinceNs = -1;      // 이벤트 루프가 깨어난 시점, 대기 중이면 -1
+    qint64 busyNs = 0;             // 이벤트 루프가 깨어 있던 시간 합 (gui%)
+    qint64 stepStartUs = 0;
+    qint64 stepEndUs = 0;
+    qint64 cpuStartUs = 0;
+};
+
+#endif // LOADTEST_H
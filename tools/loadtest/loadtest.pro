@@ -0,0 +1,39 @@
+QT       += core gui serialport widgets
+
+CONFIG += c++17 console
+CONFIG -= app_bundle
+
+TARGET = motorloadtest
+
+!linux: error("motorloadtest 는 Linux pty 가 필요합니다")
+
+INCLUDEPATH += $$PWD $$PWD/../../inc
+
+# 텔레메트리 공유 메모리 (shm_open)
+LIBS += -lrt
+
+SOURCES += \
+    main.cpp \
+    loadtest.cpp \
+    virtualmotor.cpp \
+    $$PWD/../../src/motorsession.cpp \
+    $$PWD/../../src/serialhandler.cpp \
+    $$PWD/../../src/motorcontrol.cpp \
+    $$PWD/../../src/rotationcommand.cpp \
+    $$PWD/../../src/clocksync.cpp \
+    $$PWD/../../src/jobcheckpoint.cpp \
+    $$PWD/../../src/telemetrywriter.cpp \
+    $$PWD/../../src/tracer.cpp
+
+HEADERS += \
+    loadtest.h \
+    virtualmotor.h \
+    $$PWD/../../inc/motorsession.h \
+    $$PWD/../../inc/serialhandler.h \
+    $$PWD/../../inc/motorcontrol.h \
+    $$PWD/../../inc/rotationcommand.h \
+    $$PWD/../../inc/clocksync.h \
+    $$PWD/../../inc/jobcheckpoint.h \
+    $$PWD/../../inc/telemetrywriter.h \
+    $$PWD/../../inc/telemetrylayout.h \
+    $$PWD/../../inc/tracer.h
@@ -0,0 +1,40 @@
+#include "loadtest.h"
+
+#include <QApplication>
+#include <QCommandLineParser>
+
+int main(int argc, char *argv[])
+{
+    // 위젯을 화면에 띄우지 않으므로 디스플레이 없이 실행
+    if (!qEnvironmentVariableIsSet("QT_QPA_PLATFORM")) {
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+    QApplication a(argc, argv);
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("가상 ESP32 제어기(pty)로 호스트 수신 경로의 포화 지점을 측정합니다.");
+    parser.addHelpOption();
+    QCommandLineOption startOption("start-axes", "시작 축 수", "n", "1");
+    QCommandLineOption maxOption("max-axes", "최대 축 수 (단계마다 두 배)", "n", "64");
+    QCommandLineOption rateOption("rate", "축당 TURN 주기 (Hz)", "hz", "50");
+    QCommandLineOption stepOption("step", "단계당 측정 시간 (초)", "sec", "5");
+    QCommandLineOption latencyOption("latency-limit", "p99 종단 지연 한계 (ms)", "ms", "50");
+    QCommandLineOption lossOption("loss-limit", "프레임 손실 한계 (%)", "percent", "1");
+    QCommandLineOption widgetsOption("widgets", "로그/진행률 위젯 갱신까지 포함");
+    parser.addOptions({startOption, maxOption, rateOption, stepOption, latencyOption, lossOption, widgetsOption});
+    parser.process(a);
+
+    LoadTestConfig config;
+    config.startAxes = qMax(1, parser.value(startOption).toInt());
+    config.maxAxes = qMax(config.startAxes, parser.value(maxOption).toInt());
+    config.rateHz = qMax(0.1, parser.value(rateOption).toDouble());
+    config.stepSeconds = qMax(1, parser.value(stepOption).toInt());
+    config.latencyLimitMs = parser.value(latencyOption).toDouble();
+    config.lossLimitPercent = parser.value(lossOption).toDouble();
+    config.widgets = parser.isSet(widgetsOption);
+
+    LoadTest test(config);
+    QObject::connect(&test, &LoadTest::finished, &a, &QCoreApplication::quit, Qt::QueuedConnection);
+    test.start();
+    return a.exec();
+}
@@ -0,0 +1,207 @@
+#include "virtualmotor.h"
+#include <QDebug>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <poll.h>
+#include <stdlib.h>
+#include <string>
+#include <time.h>
+#include <unistd.h>
+
+qint64 monotonicUs()
+{
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<qint64>(ts.tv_sec) * 1000000 + ts.tv_nsec / 1000;
+}
+
+VirtualMotor::~VirtualMotor()
+{
+    stop();
+    if (masterFd >= 0) {
+        ::close(masterFd);
+    }
+}
+
+bool VirtualMotor::open()
+{
+    masterFd = posix_openpt(O_RDWR | O_NOCTTY);
+    if (masterFd < 0 || grantpt(masterFd) != 0 || unlockpt(masterFd) != 0) {
+        qDebug() << "pty 생성 실패:" << strerror(errno);
+        return false;
+    }
+
+    // 호스트가 읽지 못하면 write 가 막히지 않고 EAGAIN 으로 실패하도록
+    fcntl(masterFd, F_SETFL, fcntl(masterFd, F_GETFL) | O_NONBLOCK);
+    slaveName = QString::fromLocal8Bit(ptsname(masterFd));
+    return true;
+}
+
+QString VirtualMotor::slavePath() const
+{
+    return slaveName;
+}
+
+void VirtualMotor::start(double rateHz)
+{
+    if (masterFd < 0 || running.exchange(true)) {
+        return;
+    }
+    worker = std::thread(&VirtualMotor::run, this, rateHz);
+}
+
+void VirtualMotor::startResponder(int turnPeriodMs)
+{
+    if (masterFd < 0 || running.exchange(true)) {
+        return;
+    }
+    worker = std::thread(&VirtualMotor::respond, this, qMax(1, turnPeriodMs));
+}
+
+void VirtualMotor::stop()
+{
+    running = false;
+    if (worker.joinable()) {
+        worker.join();
+    }
+}
+
+quint64 VirtualMotor::framesAttempted() const
+{
+    return attempted.load();
+}
+
+quint64 VirtualMotor::framesBlocked() const
+{
+    return blocked.load();
+}
+
+quint64 VirtualMotor::unknownCommands() const
+{
+    return unknown.load();
+}
+
+void VirtualMotor::run(double rateHz)
+{
+    const long periodNs = static_cast<long>(1e9 / rateHz);
+    timespec next;
+    clock_gettime(CLOCK_MONOTONIC, &next);
+
+    char frame[64];
+    quint64 seq = 0;
+    while (running) {
+        next.tv_nsec += periodNs;
+        while (next.tv_nsec >= 1000000000L) {
+            next.tv_nsec -= 1000000000L;
+            ++next.tv_sec;
+        }
+        clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, nullptr);
+
+        const int len = std::snprintf(frame, sizeof(frame), "TURN:%llu@%lld\n",
+                                      static_cast<unsigned long long>(++seq),
+                                      static_cast<long long>(monotonicUs()));
+        ++attempted;
+        if (::write(masterFd, frame, len) != len) {
+            ++blocked;
+        }
+    }
+}
+
+void VirtualMotor::writeFrame(const char *text)
+{
+    const ssize_t len = static_cast<ssize_t>(std::strlen(text));
+    ++attempted;
+    if (::write(masterFd, text, len) != len) {
+        ++blocked;
+    }
+}
+
+void VirtualMotor::respond(int turnPeriodMs)
+{
+    char frame[96];
+    std::string pending;
+    int target = 0;
+    int turns = 0;
+    bool active = false;
+    qint64 nextTurnUs = 0;
+
+    while (running) {
+        const int waitMs = active ? static_cast<int>(qBound<qint64>(0, (nextTurnUs - monotonicUs()) / 1000, 10)) : 10;
+        pollfd pfd{masterFd, POLLIN, 0};
+        const int ready = poll(&pfd, 1, waitMs);
+
+        if (ready > 0 && (pfd.revents & POLLIN)) {
+            char chunk[256];
+            const ssize_t n = ::read(masterFd, chunk, sizeof(chunk));
+            if (n > 0) {
+                pending.append(chunk, static_cast<size_t>(n));
+            }
+
+            // 펌웨어처럼 '\n' 으로 끝난 줄 하나를 명령 하나로 처리 (붙어 온 명령은 알 수 없는 명령이 된다)
+            size_t newline;
+            while ((newline = pending.find('\n')) != std::string::npos) {
+                std::string command = pending.substr(0, newline);
+                pending.erase(0, newline + 1);
+                if (!command.empty() && command.back() == '\r') {
+                    command.pop_back();
+                }
+
+                int rpm = 0;
+                int value = 0;
+                int consumed = 0;
+                long long t1 = 0;
+                char mode[8] = {};
+                if (command == "HELLO") {
+                    writeFrame("READY\n");
+                } else if (command == "HI") {
+                    // 연결 확인 응답, 할 일 없음
+                } else if (command == "STOP") {
+                    if (active) {
+                        active = false;
+                        std::snprintf(frame, sizeof(frame), "STOPPED@%lld\n", static_cast<long long>(monotonicUs()));
+                        writeFrame(frame);
+                    }
+                } else if (std::sscanf(command.c_str(), "PING:%lld%n", &t1, &consumed) == 1
+                           && consumed == static_cast<int>(command.size())) {
+                    const qint64 nowUs = monotonicUs();
+                    std::snprintf(frame, sizeof(frame), "PONG:%lld:%lld:%lld\n",
+                                  t1, static_cast<long long>(nowUs), static_cast<long long>(nowUs));
+                    writeFrame(frame);
+                } else if (std::sscanf(command.c_str(), "RPM:%d %7[A-Z]:%d%n", &rpm, mode, &value, &consumed) == 3
+                           && consumed == static_cast<int>(command.size())
+                           && (std::strcmp(mode, "ROT") == 0 || std::strcmp(mode, "TIME") == 0)
+                           && rpm > 0 && value > 0) {
+                    target = value;
+                    turns = 0;
+                    active = true;
+                    nextTurnUs = monotonicUs() + turnPeriodMs * 1000LL;
+                } else {
+                    ++unknown;
+                    qDebug() << "가상 제어기: 알 수 없는 명령" << QString::fromStdString(command);
+                }
+            }
+            if (pending.size() > 1024) {
+                ++unknown;
+                pending.clear();
+            }
+        } else if (ready > 0) {
+            // 슬레이브가 아직 열리지 않았거나 닫힘 (POLLHUP) - 바쁜 대기 방지
+            timespec pause{0, 5 * 1000000L};
+            nanosleep(&pause, nullptr);
+        }
+
+        if (active && monotonicUs() >= nextTurnUs) {
+            std::snprintf(frame, sizeof(frame), "TURN:%d@%lld\n", ++turns, static_cast<long long>(monotonicUs()));
+            writeFrame(frame);
+            if (turns >= target) {
+                active = false;
+                std::snprintf(frame, sizeof(frame), "DONE@%lld\n", static_cast<long long>(monotonicUs()));
+                writeFrame(frame);
+            } else {
+                nextTurnUs += turnPeriodMs * 1000LL;
+            }
+        }
+    }
+}
@@ -0,0 +1,49 @@
+#ifndef VIRTUALMOTOR_H
+#define VIRTUALMOTOR_H
+
+#include <QString>
+#include <atomic>
+#include <thread>
+
+// 호스트와 시뮬레이터가 공유하는 단조 시계 (µs)
+qint64 monotonicUs();
+
+// Linux pty 위에서 동작하는 가상 ESP32 제어기
+// 슬레이브 경로를 SerialHandler 로 열면 "TURN:<n>@<µs>" 프레임을 지정 주기로 수신한다.
+// startResponder() 로 시작하면 대신 HELLO / RPM / STOP / PING 명령에 펌웨어처럼 응답한다.
+// 명령은 '\n' 으로 끝나야 하며 한 줄에 명령 하나만 허용한다.
+class VirtualMotor
+{
+public:
+    VirtualMotor() = default;
+    ~VirtualMotor();
+
+    bool open();
+    QString slavePath() const;
+
+    void start(double rateHz);
+    void startResponder(int turnPeriodMs);   // 시간 모드도 1초를 turnPeriodMs 로 줄여 진행
+    void stop();
+
+    quint64 framesAttempted() const;   // 전송 시도 (버퍼 가득 참으로 버려진 프레임 포함)
+    quint64 framesBlocked() const;     // pty 버퍼가 가득 차 버려진 프레임
+    quint64 unknownCommands() const;   // 응답 모드에서 해석하지 못한 명령 줄 (줄바꿈 누락 등)
+
+    VirtualMotor(const VirtualMotor &) = delete;
+    VirtualMotor &operator=(const VirtualMotor &) = delete;
+
+private:
+    void run(double rateHz);
+    void respond(int turnPeriodMs);
+    void writeFrame(const char *text);
+
+    int masterFd = -1;
+    QString slaveName;
+    std::thread worker;
+    std::atomic<bool> running{false};
+    std::atomic<quint64> attempted{0};
+    std::atomic<quint64> blocked{0};
+    std::atomic<quint64> unknown{0};
+};
+
+#endif // VIRTUALMOTOR_H
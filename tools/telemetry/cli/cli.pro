@@ -0,0 +1,17 @@
+TEMPLATE = app
+CONFIG += c++2a console
+CONFIG -= qt app_bundle
+
+TARGET = motortelemetry
+
+!unix: error("motortelemetry 는 POSIX 공유 메모리가 필요합니다")
+
+INCLUDEPATH += $$PWD/../reader $$PWD/../../../inc
+
+SOURCES += \
+    main.cpp
+
+LIBS += -L$$OUT_PWD/../reader -ltelemetryreader
+PRE_TARGETDEPS += $$OUT_PWD/../reader/libtelemetryreader.a
+
+linux: LIBS += -lrt
@@ -0,0 +1,82 @@
+#include "telemetryreader.h"
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+
+// motortelemetry [--name /stepper_telemetry] [--follow] [--all]
+//   기본: 축 상태를 한 번 출력
+//   --follow: 축 상태 출력 후 새 이벤트를 계속 출력 (--all 이면 링에 남은 이벤트부터)
+
+namespace {
+
+void printAxes(const TelemetryReader &reader)
+{
+    const uint32_t count = reader.axisCount();
+    std::printf("axis  status        mode      rpm   progress/target  percent  updated(us)\n");
+    for (uint32_t i = 0; i < count; ++i) {
+        telemetry::AxisSnapshot axis;
+        if (!reader.readAxis(i, axis)) {
+            continue;
+        }
+        std::printf("%4u  %-12s  %-8s  %4d  %8d/%-6d  %6d%%  %lld\n",
+                    i, telemetry::statusName(axis.status), axis.mode == 1 ? "TIME" : "ROTATION",
+                    axis.rpm, axis.progress, axis.target, axis.percent,
+                    static_cast<long long>(axis.updatedUs));
+    }
+}
+
+void printEvent(const telemetry::EventSnapshot &event)
+{
+    std::printf("%llu  %lld  axis=%u  %s  %d/%d\n",
+                static_cast<unsigned long long>(event.index), static_cast<long long>(event.timestampUs),
+                event.axis, telemetry::eventName(event.type), event.value, event.target);
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    const char *name = telemetry::DefaultName;
+    bool follow = false;
+    bool fromOldest = false;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--name") == 0 && i + 1 < argc) {
+            name = argv[++i];
+        } else if (std::strcmp(argv[i], "--follow") == 0) {
+            follow = true;
+        } else if (std::strcmp(argv[i], "--all") == 0) {
+            fromOldest = true;
+        } else {
+            std::fprintf(stderr, "사용법: %s [--name 이름] [--follow] [--all]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    TelemetryReader reader;
+    if (!reader.open(name)) {
+        std::fprintf(stderr, "텔레메트리 공유 메모리를 열 수 없습니다: %s\n", name);
+        return 1;
+    }
+
+    printAxes(reader);
+    if (!follow) {
+        return 0;
+    }
+
+    if (!fromOldest) {
+        reader.seekToLatest();
+    }
+    uint64_t reportedLost = 0;
+    for (;;) {
+        if (reader.poll(printEvent) == 0) {
+            // 새 이벤트가 없을 때만 잠시 대기 (reader 쪽 비용, writer 와 무관)
+            const timespec idle{0, 1000000};
+            nanosleep(&idle, nullptr);
+        }
+        if (reader.lostEvents() != reportedLost) {
+            reportedLost = reader.lostEvents();
+            std::fprintf(stderr, "누락된 이벤트: %llu\n", static_cast<unsigned long long>(reportedLost));
+        }
+        std::fflush(stdout);
+    }
+}
@@ -0,0 +1,16 @@
+TEMPLATE = lib
+CONFIG += c++2a staticlib
+CONFIG -= qt
+
+TARGET = telemetryreader
+
+!unix: error("telemetryreader 는 POSIX 공유 메모리가 필요합니다")
+
+INCLUDEPATH += $$PWD $$PWD/../../../inc
+
+SOURCES += \
+    telemetryreader.cpp
+
+HEADERS += \
+    telemetryreader.h \
+    $$PWD/../../../inc/telemetrylayout.h
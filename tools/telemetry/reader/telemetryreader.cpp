@@ -0,0 +1,144 @@
+#include "telemetryreader.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+using namespace telemetry;
+
+TelemetryReader::~TelemetryReader()
+{
+    close();
+}
+
+bool TelemetryReader::open(const char *name)
+{
+    close();
+
+    const int fd = shm_open(name, O_RDONLY, 0);
+    if (fd < 0) {
+        return false;
+    }
+    void *addr = mmap(nullptr, sizeof(Header), PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (addr == MAP_FAILED) {
+        return false;
+    }
+
+    const Header *header = static_cast<const Header *>(addr);
+    if (header->magic.load(std::memory_order_acquire) != Magic
+        || header->version != Version
+        || header->maxAxes != MaxAxes
+        || header->eventCapacity != EventCapacity) {
+        munmap(addr, sizeof(Header));
+        return false;
+    }
+
+    shared = header;
+    nextIndex = 0;
+    lost = 0;
+    return true;
+}
+
+void TelemetryReader::close()
+{
+    if (shared) {
+        munmap(const_cast<Header *>(shared), sizeof(Header));
+        shared = nullptr;
+    }
+}
+
+bool TelemetryReader::isOpen() const
+{
+    return shared != nullptr;
+}
+
+uint32_t TelemetryReader::axisCount() const
+{
+    return shared ? shared->axisCount.load(std::memory_order_acquire) : 0;
+}
+
+bool TelemetryReader::readAxis(uint32_t axis, AxisSnapshot &out) const
+{
+    if (!shared || axis >= MaxAxes) {
+        return false;
+    }
+
+    // writer 가 기록 도중 멈췄으면 seq 가 홀수로 남으므로 재시도 횟수를 제한한다
+    const AxisRecord &record = shared->axes[axis];
+    for (int attempt = 0; attempt < MaxReadRetries; ++attempt) {
+        const uint64_t before = record.seq.load(std::memory_order_acquire);
+        if (before & 1) {
+            continue;   // writer 가 기록 중
+        }
+
+        AxisSnapshot snapshot;
+        snapshot.status = static_cast<AxisStatus>(record.status.load(std::memory_order_relaxed));
+        snapshot.mode = record.mode.load(std::memory_order_relaxed);
+        snapshot.rpm = record.rpm.load(std::memory_order_relaxed);
+        snapshot.target = record.target.load(std::memory_order_relaxed);
+        snapshot.progress = record.progress.load(std::memory_order_relaxed);
+        snapshot.percent = record.percent.load(std::memory_order_relaxed);
+        snapshot.updatedUs = record.updatedUs.load(std::memory_order_relaxed);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (record.seq.load(std::memory_order_relaxed) == before) {
+            out = snapshot;
+            return true;
+        }
+    }
+    return false;
+}
+
+size_t TelemetryReader::poll(const std::function<void(const EventSnapshot &)> &callback, size_t maxEvents)
+{
+    if (!shared) {
+        return 0;
+    }
+
+    const uint64_t writeIndex = shared->writeIndex.load(std::memory_order_acquire);
+    if (writeIndex < nextIndex) {
+        nextIndex = writeIndex;     // writer 가 새 레이아웃으로 다시 시작함
+    }
+    if (writeIndex - nextIndex > EventCapacity) {
+        lost += writeIndex - EventCapacity - nextIndex;
+        nextIndex = writeIndex - EventCapacity;
+    }
+
+    size_t delivered = 0;
+    while (nextIndex < writeIndex && delivered < maxEvents) {
+        const EventRecord &slot = shared->events[nextIndex & (EventCapacity - 1)];
+        const uint64_t expected = 2 * nextIndex + 2;
+
+        const uint64_t before = slot.seq.load(std::memory_order_acquire);
+        EventSnapshot event;
+        event.index = nextIndex;
+        event.timestampUs = slot.timestampUs.load(std::memory_order_relaxed);
+        event.axis = slot.axis.load(std::memory_order_relaxed);
+        event.type = static_cast<EventType>(slot.type.load(std::memory_order_relaxed));
+        event.value = slot.value.load(std::memory_order_relaxed);
+        event.target = slot.target.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        const uint64_t after = slot.seq.load(std::memory_order_relaxed);
+
+        ++nextIndex;
+        if (before != expected || after != expected) {
+            ++lost;     // 읽는 사이 writer 가 슬롯을 덮어씀
+            continue;
+        }
+        callback(event);
+        ++delivered;
+    }
+    return delivered;
+}
+
+void TelemetryReader::seekToLatest()
+{
+    if (shared) {
+        nextIndex = shared->writeIndex.load(std::memory_order_acquire);
+    }
+}
+
+uint64_t TelemetryReader::lostEvents() const
+{
+    return lost;
+}
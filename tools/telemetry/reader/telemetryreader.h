@@ -0,0 +1,41 @@
+#ifndef TELEMETRYREADER_H
+#define TELEMETRYREADER_H
+
+#include "telemetrylayout.h"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+// stepperESP32 가 게시하는 공유 메모리 텔레메트리 reader
+// 매핑 후의 모든 읽기는 시스템 호출 없이 공유 메모리에서 직접 수행되며 writer 에 영향을 주지 않는다.
+class TelemetryReader
+{
+public:
+    TelemetryReader() = default;
+    ~TelemetryReader();
+
+    bool open(const char *name = telemetry::DefaultName);
+    void close();
+    bool isOpen() const;
+
+    uint32_t axisCount() const;
+    bool readAxis(uint32_t axis, telemetry::AxisSnapshot &out) const;   // 일관된 값을 얻지 못하면 false
+
+    // 마지막 poll 이후 새 이벤트를 순서대로 전달, 반환값은 전달한 이벤트 수
+    size_t poll(const std::function<void(const telemetry::EventSnapshot &)> &callback,
+                size_t maxEvents = SIZE_MAX);
+    void seekToLatest();           // 이후 발생하는 이벤트만 받기
+    uint64_t lostEvents() const;   // 링이 덮어써서 놓친 이벤트 수
+
+    TelemetryReader(const TelemetryReader &) = delete;
+    TelemetryReader &operator=(const TelemetryReader &) = delete;
+
+private:
+    static constexpr int MaxReadRetries = 1000;
+
+    const telemetry::Header *shared = nullptr;
+    uint64_t nextIndex = 0;
+    uint64_t lost = 0;
+};
+
+#endif // TELEMETRYREADER_H
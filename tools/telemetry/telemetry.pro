@@ -0,0 +1,9 @@
+TEMPLATE = subdirs
+
+# reader: SCADA / 로거 프로세스가 링크하는 정적 라이브러리 (Qt 불필요)
+# cli:    reader 를 링크한 motortelemetry 명령
+SUBDIRS += \
+    reader \
+    cli
+
+cli.depends = reader